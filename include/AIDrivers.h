@@ -0,0 +1,104 @@
+#ifndef AIDRIVERS_H
+#define AIDRIVERS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "Car.h"
+#include "CollisionMask.h"
+#include "Config.h"
+#include "SpriteBatch.h"
+#include "TrackCenterline.h"
+
+/// @brief Computer-driven opponents following a precomputed racing line
+///
+/// Everything that depends only on the track is computed once in setRacingLine:
+/// the line points (centerline shifted by per-sample lateral offsets), their
+/// curvature and a speed profile (cornering limit from the car's turn rate,
+/// then a backward braking pass around the lap). Each tick, update() gathers
+/// the car states into flat arrays, runs pure pursuit on all drivers in one
+/// loop (local line tracking, look-ahead point pulled back when a wall hides
+/// it, steer and throttle decision) and feeds the resulting CarControls to the
+/// same Car::update as the player. resolveContacts() then separates the cars
+/// that overlap, opponents and player alike.
+class AIDrivers {
+public:
+    /// @brief Constructor
+    /// @param texture Texture holding the car (sprite atlas)
+    /// @param carRect Car region in the texture
+    AIDrivers(sf::Texture& texture, const sf::IntRect& carRect);
+
+    /// @brief Precompute the line and its speed profile
+    /// @param centerline Track centerline
+    /// @param offsets Lateral offset of each centerline sample (world units, > 0 to the right), empty = centerline
+    /// @param cornerMargin Share of the car's turn rate the speed profile relies on in corners
+    void setRacingLine(const TrackCenterline& centerline, const std::vector<float>& offsets = {},
+                       float cornerMargin = Config::AI_TURN_MARGIN);
+
+    /// @brief Create the drivers on a grid behind a start position
+    /// @param count Number of opponents
+    /// @param startDistance Arc length of the player's start position
+    void spawn(std::size_t count, float startDistance);
+
+    /// @brief Put every driver back on its grid slot
+    void reset();
+
+    /// @brief Move one driver to an arbitrary pose, at rest (headless simulations)
+    /// @param index Driver
+    /// @param position World position
+    /// @param rotation Heading in degrees
+    void place(std::size_t index, sf::Vector2f position, float rotation);
+
+    /// @brief Decide controls for every driver, then step their physics
+    /// @param deltaTime Tick duration
+    /// @param bounds Track bounds
+    /// @param mask Collision mask
+    void update(sf::Time deltaTime, const sf::FloatRect& bounds, const CollisionMask& mask);
+
+    /// @brief Resolve contacts between the drivers and with the player, after update()
+    /// @param player Player car
+    /// @param mask Collision mask
+    void resolveContacts(Car& player, const CollisionMask& mask);
+
+    /// @brief Queue the cars in the sprite batch
+    /// @param batch Sprite batch
+    /// @param alpha Interpolation factor between the last two ticks
+    void render(SpriteBatch& batch, float alpha = 1.0f) const;
+
+    std::size_t getCount() const;
+    const Car& getCar(std::size_t index) const;
+    const std::vector<CarControls>& getControls() const; ///< Controls applied on the last tick
+    std::uint32_t getLineIndex(std::size_t index) const;  ///< Line sample the driver is closest to
+    std::size_t getLineSize() const;
+
+private:
+    void computeControls(const CollisionMask& mask); ///< Batched decision step over the gathered states
+
+private:
+    sf::Texture& mTexture;
+    sf::IntRect mCarRect;
+    const TrackCenterline* mCenterline = nullptr; ///< Grid placement (owned by World)
+    std::vector<Car> mCars;
+
+    // Ligne de course (précalculée, SoA)
+    std::vector<float> mLineX;
+    std::vector<float> mLineY;
+    std::vector<float> mTargetSpeed;
+    float mSpacing = 1.f;
+
+    // États rassemblés à chaque tick (SoA)
+    std::vector<float> mPosX;
+    std::vector<float> mPosY;
+    std::vector<float> mHeadX;
+    std::vector<float> mHeadY;
+    std::vector<float> mSpeed;
+    std::vector<float> mSteer;
+    std::vector<std::uint32_t> mLineIndex; ///< Closest line sample, tracked from tick to tick
+    std::vector<float> mSkill;             ///< Fraction of the speed profile each driver aims for
+    std::vector<CarControls> mControls;
+
+    std::vector<sf::Vector2f> mGridPositions;
+    std::vector<float> mGridRotations;
+};
+
+#endif // AIDRIVERS_H
@@ -0,0 +1,97 @@
+#ifndef ASSETARCHIVE_H
+#define ASSETARCHIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include "MappedFile.h"
+
+/// @brief On-disk layout of the packed asset archive (assets.pak)
+///
+/// Header, then the index, then the blobs, each aligned on BLOB_ALIGNMENT.
+/// PNG images up to RGBA8_MAX_BYTES decoded are stored pre-decoded as raw
+/// RGBA8 so the game skips the PNG decoder for them; larger images (circuits)
+/// and other files (fonts...) are stored as-is. Written by
+/// tools/AssetPacker.cpp, read by AssetArchive. Little-endian only.
+namespace PackFormat {
+    inline constexpr char MAGIC[8] = {'R', 'R', 'P', 'A', 'K', '0', '1', '\0'};
+    inline constexpr std::size_t BLOB_ALIGNMENT = 64;
+    inline constexpr std::size_t NAME_SIZE = 96;
+    inline constexpr std::uint64_t RGBA8_MAX_BYTES = 16ull * 1024 * 1024; ///< Bigger PNGs stay compressed
+
+    /// @brief Blob encoding
+    enum class Format : std::uint32_t {
+        Raw = 0,   ///< Original file bytes
+        Rgba8 = 1  ///< Pre-decoded image, width * height * 4 bytes
+    };
+
+    struct Header {
+        char magic[8];
+        std::uint32_t entryCount;
+        std::uint32_t reserved;
+    };
+
+    struct Entry {
+        char name[NAME_SIZE];    ///< Path relative to assets/, '/' separators, zero-padded
+        std::uint64_t offset;    ///< From the start of the archive, aligned
+        std::uint64_t size;      ///< Blob size in bytes
+        std::uint32_t width;     ///< Rgba8 only
+        std::uint32_t height;    ///< Rgba8 only
+        Format format;
+        std::uint32_t reserved;
+    };
+}
+
+/// @brief One asset inside the mapped archive (points straight into the mapping)
+struct PackedAsset {
+    const std::uint8_t* data = nullptr;
+    std::size_t size = 0;
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    PackFormat::Format format = PackFormat::Format::Raw;
+};
+
+/// @brief Cache key of a file: hash of its size and modification time (0 if missing)
+/// @param path File
+/// @return Key changing whenever the file is rewritten
+std::uint64_t fileFingerprint(const std::string& path);
+
+/// @brief Read-only memory mapping of a packed asset archive
+///
+/// The file is mapped once (mmap / MapViewOfFile); lookups return pointers
+/// into the mapping, which stays valid until the archive is destroyed.
+class AssetArchive {
+public:
+    AssetArchive() = default;
+    ~AssetArchive();
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    /// @brief Map an archive and read its index
+    /// @param path Archive file
+    /// @return True if mapped and valid
+    bool open(const std::string& path);
+
+    /// @brief Check if an archive is mapped
+    bool isOpen() const;
+
+    /// @brief Find an asset by its path relative to assets/
+    /// @param name Relative path, e.g. "textures/voiture.png"
+    /// @return Asset, or nullptr if absent
+    const PackedAsset* find(const std::string& name) const;
+
+    /// @brief Identifier changing when the archive is rebuilt (cache keys)
+    std::uint64_t getSourceKey() const;
+
+private:
+    void close();
+
+private:
+    MappedFile mFile;
+    std::uint64_t mSourceKey = 0;
+    std::unordered_map<std::string, PackedAsset> mEntries;
+};
+
+#endif // ASSETARCHIVE_H
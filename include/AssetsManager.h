@@ -2,8 +2,30 @@
 #define ASSETSMANAGER_H
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <deque>
+#include <mutex>
 #include <string>
-#include <map>
+#include <unordered_map>
+#include "AssetArchive.h"
+#include "TextureAtlas.h"
+
+/**
+ * @brief Typed index into the AssetsManager storage
+ *
+ * Resolved once at load time; lookups through a handle are a plain index.
+ * The tag keeps texture and font handles from being mixed up.
+ */
+template <class Asset>
+struct AssetHandle {
+    static constexpr std::uint32_t INVALID = 0xFFFFFFFFu;
+    std::uint32_t index = INVALID;
+
+    bool isValid() const { return index != INVALID; }
+};
+
+using TextureHandle = AssetHandle<sf::Texture>;
+using FontHandle = AssetHandle<sf::Font>;
 
 /**
  * @brief Manage game assets like textures and fonts
@@ -15,42 +37,122 @@ public:
      */
     AssetsManager();
 
+    /**
+     * @brief Map the packed archive; assets found in it skip the filesystem and the PNG decoder
+     * @param path Archive built by AssetPacker
+     * @return true if mapped (otherwise loose files are used)
+     */
+    bool openArchive(const std::string& path);
+
+    /**
+     * @brief Find an asset in the mapped archive
+     * @param filepath Loose-file path (under Config::ASSETS_PATH)
+     * @return Entry pointing into the mapping, or nullptr if not packed
+     */
+    const PackedAsset* findPacked(const std::string& filepath) const;
+
+    /**
+     * @brief Check if an asset exists, packed or as a loose file
+     * @param filepath Loose-file path (under Config::ASSETS_PATH)
+     */
+    bool hasAsset(const std::string& filepath) const;
+
+    /**
+     * @brief Identifier of the mapped archive build (0 without archive), for derived caches
+     */
+    std::uint64_t getArchiveKey() const;
+
+    /**
+     * @brief Decode an image, from the archive (packed PNG or RGBA) or a loose file (any thread)
+     * @param filepath Loose-file path (under Config::ASSETS_PATH)
+     * @param image Decoded pixels
+     * @return true if decoded
+     */
+    bool loadImage(const std::string& filepath, sf::Image& image) const;
+
     /**
      * @brief Load a texture from a file
      * @param name Identifier for the texture
      * @param filepath Path to the texture file
-     * @return true if loaded successfully
+     * @return Handle, invalid if loading failed
+     */
+    TextureHandle loadTexture(const std::string& name, const std::string& filepath);
+
+    /**
+     * @brief Get a texture by handle
+     * @param handle Texture handle
+     * @return Reference to the texture (stable for the manager's lifetime)
+     */
+    sf::Texture& getTexture(TextureHandle handle);
+
+    /**
+     * @brief Queue an image file for the sprite atlas (decoded here, any thread)
+     * @param name Region name
+     * @param filepath Path to the image file
+     * @return true if decoded
+     */
+    bool addAtlasImage(const std::string& name, const std::string& filepath);
+
+    /**
+     * @brief Queue generated pixels for the sprite atlas (any thread)
+     * @param name Region name
+     * @param image Pixels, copied
+     */
+    void addAtlasImage(const std::string& name, const sf::Image& image);
+
+    /**
+     * @brief Pack the queued images and upload the atlas (main thread only)
+     * @param name Identifier of the atlas texture
+     * @return Handle of the atlas texture, invalid if packing failed
      */
-    bool loadTexture(const std::string& name, const std::string& filepath);
+    TextureHandle buildAtlas(const std::string& name);
 
     /**
-     * @brief Get a texture by name
-     * @param name Identifier of the texture
-     * @return Reference to the texture
+     * @brief Get the atlas region of an image by name (load time, not per frame)
+     * @param name Region name given to addAtlasImage
+     * @return Region in atlas pixels
      */
-    sf::Texture& getTexture(const std::string& name);
+    sf::IntRect getAtlasRegion(const std::string& name) const;
 
     /**
      * @brief Load a font from a file
      * @param name Identifier for the font
      * @param filepath Path to the font file
-     * @return true if loaded successfully
+     * @return Handle, invalid if loading failed
      */
-    bool loadFont(const std::string& name, const std::string& filepath);
+    FontHandle loadFont(const std::string& name, const std::string& filepath);
 
     /**
-     * @brief Get a font by name
-     * @param name Identifier of the font
-     * @return Reference to the font
+     * @brief Get a font by handle
+     * @param handle Font handle
+     * @return Reference to the font (stable for the manager's lifetime)
      */
-    sf::Font& getFont(const std::string& name);
+    sf::Font& getFont(FontHandle handle);
 
     void setUseSDAssets(bool value) { mUseSD = value; }
     bool isUsingSDAssets() const { return mUseSD; }
 
 private:
-    std::map<std::string, sf::Texture> mTextures; ///< Loaded textures
-    std::map<std::string, sf::Font> mFonts;       ///< Loaded fonts
+    enum class LoadState : std::uint8_t { Pending, Ready, Failed };
+
+    struct TextureSlot {
+        sf::Texture texture;
+        LoadState state = LoadState::Pending;
+        std::string filepath;
+    };
+
+    TextureHandle allocateTexture(const std::string& name, const std::string& filepath);
+    static bool uploadPacked(sf::Texture& texture, const PackedAsset& asset);
+
+private:
+    AssetArchive mArchive;                         ///< Declared first: fonts read their data from the mapping
+    // std::deque : indexation O(1) et adresses stables (les sprites pointent sur les textures)
+    std::deque<TextureSlot> mTextures;             ///< Loaded textures, indexed by handle
+    std::deque<sf::Font> mFonts;                   ///< Loaded fonts, indexed by handle
+    std::unordered_map<std::string, std::uint32_t> mTextureNames;
+    std::unordered_map<std::string, std::uint32_t> mFontNames;
+    TextureAtlas mAtlas;                           ///< Car, ghost and HUD glyphs in one texture
+    std::mutex mAtlasMutex;                        ///< Atlas images are queued from several threads
     bool mUseSD = false;
 };
 
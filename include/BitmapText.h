@@ -0,0 +1,86 @@
+#ifndef BITMAPTEXT_H
+#define BITMAPTEXT_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+#include "GlyphAtlas.h"
+
+/// @brief Fixed-capacity text fields sharing one preallocated vertex array
+///
+/// Fields and quads are declared once at start-up. setText() compares the new
+/// string with the previous one and only rewrites the quads of characters that
+/// changed or moved, without any allocation. Everything is drawn in one call
+/// with the glyph atlas texture; unused slots are degenerate quads.
+class BitmapText {
+public:
+    enum class Align { Left, Center, Right };
+
+    /// @brief Constructor
+    /// @param atlas Glyph atlas (must outlive the text)
+    explicit BitmapText(const GlyphAtlas& atlas);
+
+    /// @brief Declare a text field (start-up only)
+    /// @param capacity Maximum number of characters
+    /// @param characterSize Display size in pixels
+    /// @param color Fill color
+    /// @param outlined Draw the black outline under the glyphs
+    /// @param align Horizontal alignment relative to the position
+    /// @return Field index
+    std::size_t addField(std::size_t capacity, float characterSize, sf::Color color, bool outlined, Align align = Align::Left);
+
+    /// @brief Declare plain colored quads (start-up only)
+    /// @param count Number of quads
+    /// @return Index of the first quad
+    std::size_t addQuads(std::size_t count);
+
+    /// @brief Move a field and relayout its current text
+    void setPosition(std::size_t field, sf::Vector2f position);
+
+    /// @brief Change a field's text; '\n' starts a new line
+    /// @param field Field index
+    /// @param text Text, truncated to the field capacity
+    void setText(std::size_t field, const char* text);
+
+    /// @brief Move every texture coordinate already written (glyph page relocated)
+    /// @param delta Offset added to the texture coordinates
+    void shiftTexCoords(sf::Vector2f delta);
+
+    /// @brief Write a plain colored quad
+    void setQuad(std::size_t quad, sf::Vector2f position, sf::Vector2f size, sf::Color color);
+
+    /// @brief Number of vertices declared so far (marks a range for draw())
+    std::size_t getVertexCount() const;
+
+    /// @brief Draw the first vertices in a single call
+    /// @param target Render target
+    /// @param vertexCount Vertices to draw (everything by default)
+    void draw(sf::RenderTarget& target, std::size_t vertexCount = static_cast<std::size_t>(-1)) const;
+
+private:
+    struct Field {
+        std::size_t firstVertex;
+        std::size_t firstChar;  ///< Offset in mChars / mPens
+        std::size_t capacity;
+        std::size_t length = 0;
+        float scale;
+        sf::Color color;
+        bool outlined;
+        Align align;
+        sf::Vector2f position;
+        bool moved = true;      ///< Position changed: rewrite every character
+    };
+
+    float lineWidth(const Field& field, const char* text, std::size_t length) const;
+    void writeGlyph(sf::Vertex* quad, const GlyphAtlas::Glyph& glyph, sf::Vector2f pen, float scale, sf::Color color);
+    static void clearQuad(sf::Vertex* quad);
+
+private:
+    const GlyphAtlas& mAtlas;
+    std::vector<sf::Vertex> mVertices;
+    std::vector<Field> mFields;
+    std::vector<char> mChars;          ///< Characters currently written, per slot
+    std::vector<sf::Vector2f> mPens;   ///< Pen position of each written slot
+};
+
+#endif // BITMAPTEXT_H
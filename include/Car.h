@@ -4,6 +4,8 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include "CollisionMask.h"
+#include "SpriteBatch.h"
+#include <array>
 #include <memory>
 
 struct CarControls {
@@ -15,23 +17,38 @@ struct CarControls {
 
 class Car {
 public:
-    explicit Car(sf::Texture& texture);
+    // textureRect : région de la voiture dans l'atlas de sprites
+    Car(sf::Texture& texture, const sf::IntRect& textureRect);
 
     void update(sf::Time deltaTime, const CarControls& inputs, const sf::FloatRect& trackBounds, const CollisionMask& mask);
-    void render(sf::RenderWindow& window, float alpha = 1.0f);
+    void render(SpriteBatch& batch, float alpha = 1.0f) const;
 
     sf::Vector2f getPosition() const;
     sf::Vector2f getInterpolatedPosition(float alpha) const;
+    sf::Transform getInterpolatedTransform(float alpha) const;
     void setPosition(const sf::Vector2f& pos);
 
     const sf::Sprite& getSprite() const;
     void resetVelocity();
     void setRotation(float angle);
+    void setColor(sf::Color color);       ///< Sprite tint (opponents)
     float getRotation() const;
     float getSpeed() const;
+    sf::Vector2f getVelocity() const;
+    sf::Vector2f getHalfSize() const;     ///< Half length (x) and half width (y) in world units
+    std::array<sf::Vector2f, 2> getRearWheelPositions() const; ///< Left and right rear wheels in world units
+    float getLateralSlip() const;         ///< Lateral speed removed by grip on the last tick
+    float getGrassIntensity() const;
+    float getSteer() const;               ///< Smoothed steering, -1 (left) to 1 (right)
 
     void setupAudio(const sf::SoundBuffer& buffer);
 
+    /// @brief Push two overlapping cars apart and exchange their closing speed
+    /// @param other Car tested against this one
+    /// @param mask Collision mask (a push never moves a car into a wall)
+    /// @return True if the cars were in contact
+    bool collideWith(Car& other, const CollisionMask& mask);
+
 private:
     static float lerpAngle(float start, float end, float t);
 
@@ -54,6 +71,7 @@ private:
 
     float mCurrentSteer = 0.0f;
     float mGrassIntensity = 0.0f;
+    float mLateralSlip = 0.0f;
 };
 
 #endif
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include "ThreadPool.h"
 
 // Types de terrain simplifiés pour l'optimisation
 enum class TerrainType : uint8_t {
@@ -19,20 +20,36 @@ class CollisionMask {
 public:
     CollisionMask();
 
-    bool loadFromFile(const std::string& path);
+    // pool optionnel : classification des lignes en parallèle
+    bool loadFromFile(const std::string& path, ThreadPool* pool = nullptr);
+    // Pixels RGBA déjà décodés (archive mappée) : lus sur place, sans copie
+    bool loadFromPixels(const std::uint8_t* pixels, sf::Vector2u size, ThreadPool* pool = nullptr);
     void setScale(float scale);
 
     bool isOnGrass(sf::Vector2f worldPos) const;
     bool isOnGreen(sf::Vector2f worldPos) const; // Checkpoint
     bool isOnBlue(sf::Vector2f worldPos) const;  // Finish
     bool isTraversable(sf::Vector2f worldPos) const;
+    TerrainType getTerrain(sf::Vector2f worldPos) const;
+
+    // Distance (monde) au premier MUR le long d'un rayon, parcours DDA des cases de la grille.
+    // maxDistance si aucun mur à portée, 0 si l'origine est dans un mur
+    float raycast(sf::Vector2f origin, sf::Vector2f direction, float maxDistance) const;
+    // Éventail de rayCount rayons répartis sur fov degrés autour de heading (degrés, comme Car),
+    // du bord gauche au bord droit : une distance par rayon dans distances
+    void raycastFan(sf::Vector2f origin, float heading, std::size_t rayCount, float fov,
+                    float maxDistance, float* distances) const;
+
+    // Accès direct à la grille (pré-traitements hors boucle de jeu)
+    const std::vector<TerrainType>& getGrid() const;
+    sf::Vector2u getSize() const;
 
 private:
     sf::Vector2u worldToImage(sf::Vector2f pos) const;
     TerrainType getTerrainAt(unsigned int x, unsigned int y) const;
+    float traverse(sf::Vector2f origin, sf::Vector2f direction, float maxDistance) const; // Direction unitaire
 
 private:
-    sf::Image mImage;
     sf::Vector2u mSize;
     float mScale;
 
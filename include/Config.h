@@ -1,12 +1,18 @@
 #ifndef CONFIG_H
 #define CONFIG_H
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace Config {
     inline const std::string ASSETS_PATH = "../assets/";
     inline const std::string TEXTURES_PATH = ASSETS_PATH + "textures/";
     inline const std::string FONTS_PATH = ASSETS_PATH + "fonts/";
+    inline const std::string CACHE_PATH = ASSETS_PATH + "cache/";   // Données dérivées des assets (LOD, ligne centrale)
+    inline const std::string SAVE_PATH = "saves/";                  // Sauvegardes du joueur (fantôme, classements, replays)
+
+    inline const std::string ASSET_ARCHIVE_PATH = ASSETS_PATH + "assets.pak"; // Construite par AssetPacker, à côté des fichiers qu'elle remplace
 
     inline const std::string FILE_CIRCUIT_HD = "circuit.png";
     inline const std::string FILE_CIRCUIT_SD = "circuit_sd.png";
@@ -22,9 +28,25 @@ namespace Config {
     inline constexpr float FPS = PHYSICS_FPS;
 
     inline constexpr bool ENABLE_VSYNC = false;
-    inline constexpr unsigned int FRAME_LIMIT = 60;
+    inline constexpr unsigned int FRAME_LIMIT = 60;      // Cadence de présentation visée (0 = illimité)
+    inline constexpr unsigned int IDLE_FRAME_RATE = 10;  // Cadence en veille (fenêtre sans focus)
+    inline constexpr unsigned int MENU_FRAME_RATE = 30;  // Cadence du menu (seul le texte clignote)
     inline constexpr unsigned int ANTIALIASING_LEVEL = 0;
 
+    // --- ATLAS DE SPRITES ---
+    inline const std::string SPRITE_CAR = "voiture";        // Région de la voiture (joueur + fantôme)
+    inline const std::string SPRITE_HUD_GLYPHS = "hud_glyphs"; // Page de glyphes du HUD
+    inline constexpr unsigned int ATLAS_MAX_SIZE = 4096;    // Côté max de l'atlas (px)
+    inline constexpr unsigned int ATLAS_PADDING = 8;        // Bordure répétée autour de chaque région (px) : filtrage et 3 premiers mipmaps sans voisin
+
+    // --- CIRCUIT EN TUILES ---
+    inline constexpr unsigned int TRACK_TILE_SIZE = 512;             // Côté d'une tuile (pixels image)
+    inline constexpr unsigned int TRACK_TILE_CACHE_SIZE = 32;        // Textures GPU min (grandit avec la vue)
+    inline constexpr unsigned int TRACK_TILE_UPLOADS_PER_FRAME = 2;  // Uploads de préchargement par frame
+    inline constexpr unsigned int TRACK_PREVIEW_MAX_SIZE = 1024;     // Niveaux LOD ayant une texture entière
+    inline constexpr unsigned int TRACK_LOD_MIN_SIZE = 128;          // Arrêt de la pyramide LOD
+    inline const std::string TRACK_LOD_CACHE_EXTENSION = ".lod";     // Cache disque de la pyramide
+
     // --- CAMERA (NOUVEAU) ---
     inline constexpr float CAMERA_WIDTH = 120.0f;
     inline constexpr float CAMERA_HEIGHT = 67.5f;
@@ -43,7 +65,6 @@ namespace Config {
     inline constexpr float CAR_MAX_TURN_RATE = 90.0f;
     inline constexpr float CAR_FRICTION = 6.0f;
     inline constexpr float CAR_MAX_SPEED_GRASS = 25.0f; // Gardé pour référence, mais géré par le Drag maintenant
-    inline constexpr unsigned int TEXTURE_LIMIT_THRESHOLD = 4096;
 
     // --- PHYSIQUE AVANCEE (NOUVEAU - NETTOYAGE MAGIC NUMBERS) ---
     inline constexpr float CAR_ACCEL_BOOST = 1.1f;         // Boost global d'accélération
@@ -55,6 +76,107 @@ namespace Config {
     inline constexpr float ROAD_DRAG_FACTOR = 0.002f;      // Résistance air sur route
     inline constexpr float STEER_FRICTION_FACTOR = 4.0f;   // Friction ajoutée en braquant
     inline constexpr float STEER_POWER_LOSS = 0.05f;       // Perte puissance en braquant
+    inline constexpr float CAR_CONTACT_RESTITUTION = 0.3f; // Rebond entre deux voitures (comme contre un mur)
+
+    // --- PARTICULES ---
+    inline constexpr unsigned int PARTICLE_CAPACITY = 32768;    // Pool fixe (aucune allocation en jeu)
+    inline constexpr float DRIFT_SMOKE_SLIP_THRESHOLD = 1.2f;   // Glissement latéral (m/s) avant fumée
+    inline constexpr float PARTICLE_SMOKE_RATE = 40.0f;         // Particules/s par m/s de glissement en excès
+    inline constexpr float PARTICLE_GRASS_RATE = 1.5f;          // Particules/s par m/s de vitesse sur herbe
+    inline constexpr float PARTICLE_DRAG = 2.0f;                // Freinage des particules (1/s)
+
+    // --- QUALITE DYNAMIQUE ---
+    inline constexpr float QUALITY_SMOOTHING = 0.1f;            // Poids d'une frame dans la moyenne glissante
+    inline constexpr float QUALITY_DOWN_RATIO = 0.9f;           // Baisse au-delà de 90% du budget...
+    inline constexpr int QUALITY_DOWN_FRAMES = 30;              // ...pendant N frames consécutives
+    inline constexpr float QUALITY_UP_RATIO = 0.5f;             // Remontée sous 50% du budget...
+    inline constexpr int QUALITY_UP_FRAMES = 180;               // ...pendant N frames consécutives
+    inline constexpr int QUALITY_COOLDOWN_FRAMES = 90;          // Stabilisation après chaque changement
+
+    // --- MINIMAP ---
+    inline constexpr unsigned int MINIMAP_WIDTH = 240;          // Largeur max de la minimap (px)
+    inline constexpr float MINIMAP_MARGIN = 10.f;               // Marge au coin bas-gauche (px)
+
+    // --- TRACES DE PNEUS ---
+    inline constexpr float SKID_SLIP_THRESHOLD = 1.0f;          // Dérapage latéral minimal pour marquer la piste
+    inline constexpr float SKID_MARK_WIDTH = 0.35f;             // Largeur d'une trace (unités monde)
+    inline constexpr std::uint8_t SKID_MARK_ALPHA = 90;         // Opacité d'un tampon (cumulée en repassant)
+    inline constexpr float SKID_TEXELS_PER_UNIT = 4.f;          // Résolution de la couche de traces
+    inline constexpr unsigned int SKID_TILE_SIZE = 1024;        // Côté d'une tuile de traces (px)
+    inline constexpr float SKID_FADE_INTERVAL = 0.5f;           // Chaque tuile marquée est estompée toutes les X secondes
+    inline constexpr std::uint8_t SKID_FADE_STEP = 3;           // Opacité retirée à chaque passage (/255) : trace pleine effacée en ~43 s
+
+    // --- SCORES ---
+    inline const std::string SCORE_SNAPSHOT_FILE = SAVE_PATH + "scores.dat"; // Tables compactées
+    inline const std::string SCORE_LOG_FILE = SAVE_PATH + "scores.log";      // Journal des temps depuis le dernier compactage
+    inline const std::string GHOST_FILE = SAVE_PATH + "ghost.dat";           // Meilleur tour du joueur
+    inline constexpr std::size_t GHOST_MAX_POINTS = 1u << 24;                // Au-delà, fichier fantôme jugé corrompu
+    inline const std::string REPLAY_PATH = SAVE_PATH + "replays/";           // Fantôme de chaque entrée du classement
+    inline constexpr std::size_t SCORE_TABLE_CAPACITY = 1024;      // Temps gardés par circuit
+    inline constexpr unsigned int SCORE_COMPACT_INTERVAL = 32;     // Ajouts entre deux compactages
+    inline constexpr std::size_t MENU_SCORES_SHOWN = 5;            // Lignes du classement dans le menu
+
+    // --- TELEMETRIE ---
+    inline constexpr std::uint32_t TELEMETRY_CHUNK_TICKS = 4096;   // Ticks par bloc compressé (~68 s à 60 Hz)
+    inline constexpr std::size_t TELEMETRY_CHUNK_BUFFERS = 3;      // Blocs préalloués (remplissage + écriture)
+
+    // --- LIGNE CENTRALE ---
+    inline constexpr unsigned int CENTERLINE_GRID_MAX = 1024;      // Côté max de la grille amincie (masque réduit au-delà)
+    inline constexpr unsigned int CENTERLINE_CONTROL_SPACING = 6;  // Pixels de squelette entre deux points de contrôle
+    inline constexpr unsigned int CENTERLINE_SMOOTHING = 8;        // Rayon de la moyenne glissante (pixels de squelette)
+    inline constexpr float CENTERLINE_SAMPLE_SPACING = 1.0f;       // Pas de rééchantillonnage (unités monde)
+    inline constexpr std::size_t CENTERLINE_PROJECT_WINDOW = 64;   // Échantillons examinés de part et d'autre d'un indice
+    inline const std::string CENTERLINE_CACHE_EXTENSION = ".line"; // Cache disque des points de contrôle (sous CACHE_PATH)
+
+    // --- PILOTES IA ---
+    inline constexpr std::size_t AI_MAX_DRIVERS = 20;              // Adversaires max (--ai <n>)
+    inline constexpr float AI_LOOKAHEAD_MIN = 6.f;                 // Distance de visée à l'arrêt (unités monde)
+    inline constexpr float AI_LOOKAHEAD_TIME = 0.35f;              // + vitesse x ce temps (s)
+    inline constexpr std::size_t AI_SIGHT_RETRIES = 3;             // Visée divisée par deux au plus X fois si un mur la cache
+    inline constexpr float AI_CURVATURE_WINDOW = 8.f;              // Demi-corde de mesure de la courbure (unités monde)
+    inline constexpr float AI_TURN_MARGIN = 0.8f;                  // Part du taux de rotation max utilisée en virage
+    inline constexpr float AI_BRAKING = 35.f;                      // Décélération supposée au freinage (unités/s²)
+    inline constexpr float AI_REACTION_TIME = 0.25f;               // Anticipation du profil de vitesse (s)
+    inline constexpr float AI_BRAKE_MARGIN = 2.f;                  // Excès de vitesse toléré avant freinage
+    inline constexpr float AI_STEER_DEADBAND = 0.05f;              // Écart de braquage ignoré
+    inline constexpr float AI_SKILL_MIN = 0.85f;                   // Part du profil visée par le plus lent
+    inline constexpr std::size_t AI_TRACKING_STEPS = 32;           // Pas max du suivi local de la ligne par tick
+    inline constexpr float AI_GRID_SPACING = 6.f;                  // Écart entre deux rangs de la grille
+    inline constexpr float AI_GRID_LATERAL = 2.f;                  // Décalage latéral d'une place de grille
+
+    // --- OPTIMISEUR DE TRAJECTOIRE ---
+    inline constexpr std::size_t OPT_POPULATION = 128;             // Candidats par génération
+    inline constexpr std::size_t OPT_ELITE = 12;                   // Meilleurs gardés tels quels (et seuls parents)
+    inline constexpr float OPT_KNOT_SPACING = 30.f;                // Un décalage optimisé tous les X (unités monde)
+    inline constexpr float OPT_EDGE_MARGIN = 0.5f;                 // Marge au bord de piste en plus de la demi-largeur de la voiture
+    inline constexpr float OPT_MAX_HALF_WIDTH = 60.f;              // Arrêt de la mesure de largeur
+    inline constexpr float OPT_WIDTH_STEP = 0.25f;                 // Pas de la mesure de largeur
+    inline constexpr float OPT_MUTATION_RATE = 0.25f;              // Probabilité de muter un nœud
+    inline constexpr float OPT_MUTATION_SCALE = 0.25f;             // Écart-type initial (part de la largeur)
+    inline constexpr float OPT_MARGIN_MIN = 0.6f;                  // Bornes du coefficient de vitesse en virage
+    inline constexpr float OPT_MARGIN_MAX = 1.0f;
+    inline constexpr float OPT_GRASS_PENALTY = 2.f;                // Secondes ajoutées par seconde passée dans l'herbe
+    inline constexpr float OPT_MAX_LAP_TIME = 180.f;               // Abandon d'une simulation (s)
+    inline constexpr float OPT_STALL_TIME = 3.f;                   // Abandon sans progression pendant X s
+    inline constexpr unsigned int OPT_SEED = 20240607;             // Graine : résultats reproductibles
+    inline const std::string REFERENCE_GHOST_FILE = SAVE_PATH + "reference_ghost.dat"; // Meilleur tour simulé
+
+    // --- ENVIRONNEMENT VECTORISE ---
+    inline constexpr std::size_t VECENV_RAYS = 9;                  // Rayons de distance au mur par observation
+    inline constexpr float VECENV_RAY_FOV = 180.f;                 // Éventail des rayons, centré sur le cap (degrés)
+    inline constexpr float VECENV_RAY_RANGE = 60.f;                // Portée d'un rayon (unités monde)
+    inline constexpr float VECENV_PROGRESS_REWARD = 0.1f;          // Récompense par unité de ligne centrale parcourue
+    inline constexpr float VECENV_GRASS_PENALTY = 1.f;             // Pénalité par seconde passée dans l'herbe
+    inline constexpr float VECENV_MAX_EPISODE_TIME = 120.f;        // Fin d'épisode (s)
+    inline constexpr float VECENV_STALL_TIME = 3.f;                // Fin d'épisode sans progression pendant X s
+    inline constexpr unsigned int VECENV_SEED = 20240611;          // Graine des positions de départ
+    inline constexpr std::size_t VECENV_BENCH_ENVS = 256;          // Environnements du benchmark (--bench-vecenv)
+    inline constexpr std::size_t VECENV_BENCH_STEPS = 2000;        // Pas simulés par le benchmark
+
+    // --- CARTE DE CHALEUR ---
+    inline constexpr unsigned int HEATMAP_CELL = 4;                // Côté d'une case (pixels du masque)
+    inline constexpr std::uint32_t HEATMAP_MIN_SAMPLES = 3;        // Échantillons avant de colorer une case
+    inline constexpr float HEATMAP_OVERLAY_ALPHA = 170.f;          // Opacité max de la surcouche en jeu
 
     // --- REGLES ---
     inline constexpr int COUNTDOWN_START_VALUE = 3;
@@ -0,0 +1,70 @@
+#ifndef DRIVINGHEATMAP_H
+#define DRIVINGHEATMAP_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CollisionMask.h"
+#include "ThreadPool.h"
+
+/// @brief Where cars drive and how fast, aggregated over many laps
+///
+/// Positions from telemetry recordings (or ghost files) are binned into a grid
+/// of Config::HEATMAP_CELL x HEATMAP_CELL mask pixels, counting samples and
+/// summing speeds. Binning runs on the thread pool, each thread filling its own
+/// grid; the grids are then summed bin range by bin range, also in parallel.
+/// The result is colored by mean speed (red = slow, green = fast) with an
+/// opacity following the sample density.
+class DrivingHeatmap {
+public:
+    /// @brief Samples binned in one cell
+    struct Bin {
+        std::uint32_t count = 0;
+        float speedSum = 0.f;
+    };
+
+    /// @brief Constructor
+    /// @param maskSize Collision mask size in pixels (grid alignment)
+    /// @param worldSize Track size in world units (covered by the mask)
+    DrivingHeatmap(sf::Vector2u maskSize, sf::Vector2f worldSize);
+
+    /// @brief Bin every file (telemetry recording, otherwise ghost file) in parallel
+    /// @param inputs Input files, or directories whose *.rrt and *.dat files are all read (recursively)
+    /// @param threadPool Pool running the binning and the reduction
+    /// @return Number of files read
+    std::size_t addFiles(const std::vector<std::string>& inputs, ThreadPool& threadPool);
+
+    /// @brief Color the bins over a dimmed copy of the terrain
+    /// @param mask Terrain drawn under the heat (nullptr = transparent background)
+    /// @return RGBA pixels, one per bin
+    std::vector<std::uint8_t> colorize(const CollisionMask* mask) const;
+
+    /// @brief Upload the colored bins for the in-game overlay (main thread)
+    void createTexture();
+
+    /// @brief Draw the overlay over the track (world view)
+    /// @param target Render target
+    void render(sf::RenderTarget& target) const;
+
+    sf::Vector2u getGridSize() const;
+    std::uint64_t getSampleCount() const;
+
+    /// @brief Headless mode (--heatmap-out): bin the inputs, write a PNG, print the slowest cells
+    /// @param inputs Telemetry or ghost files, or directories of them
+    /// @param outputPath PNG written
+    /// @return Process exit code
+    static int runTool(const std::vector<std::string>& inputs, const std::string& outputPath);
+
+private:
+    void binSample(std::vector<Bin>& grid, float x, float y, float speed) const;
+
+private:
+    sf::Vector2u mGridSize;
+    sf::Vector2f mWorldToGrid;       ///< World units -> bins
+    std::vector<Bin> mBins;
+    std::uint64_t mSamples = 0;
+    sf::Texture mTexture;
+};
+
+#endif // DRIVINGHEATMAP_H
@@ -3,43 +3,78 @@
 
 #include <SFML/Graphics.hpp>
 #include <SFML/Window.hpp>
+#include <chrono>
 #include <memory>
+#include <string>
+#include "Config.h"
 #include "World.h"
 #include "AssetsManager.h"
 #include "Menu.h"
 #include "Hud.h"
 #include "Camera.h"
 #include "GameManager.h"
+#include "FramePacer.h"
+#include "LaunchOptions.h"
+#include "InputManager.h"
+#include "LatencyTracker.h"
+#include "ThreadPool.h"
+#include "QualityGovernor.h"
+#include "ScoreStore.h"
+#include "TelemetryRecorder.h"
 
 class Engine {
 public:
-    Engine();
+    explicit Engine(const LaunchOptions& options = LaunchOptions());
     void run();
 
 private:
+    void loadResources();  ///< Startup task graph with a loading screen
+    void renderLoadingScreen(float progress, const std::string& label, const sf::Font* font);
+    float msSinceStartup() const;
+
     void processEvents();
-    void update(sf::Time deltaTime);
+    void update(sf::Time deltaTime, InputManager::Clock::time_point tickEnd);
+    void recordTelemetry(const CarControls& controls);
     void render(float alpha);
+    void renderWorld(float alpha); ///< At the governor's resolution scale, upscaled to the window
 
     // Nouvelle fonction pour gérer proprement la création/bascule
     void recreateWindow();
     void toggleFullscreen();
+    void applyPacing(); ///< Pick the pacer mode from focus and menu state
 
 private:
+    std::chrono::steady_clock::time_point mStartupBegin; ///< Time-to-first-frame / time-to-interactive origin
+    bool mInteractive = false;
+    LaunchOptions mOptions;
     sf::ContextSettings mContextSettings;
     sf::RenderWindow mWindow;
     sf::View mCamera;
     sf::Time mTimePerFrame;
+    FramePacer mPacer;
+    InputManager mInput;
+    FramePacer::Mode mActivePacing; ///< Mode restored when the window regains focus
 
     AssetsManager mAssetsManager;
+    ThreadPool mThreadPool; ///< Declared before mWorld: outlives the track's tile jobs
     std::unique_ptr<World> mWorld;
     std::unique_ptr<Menu> mMenu;
     std::unique_ptr<HUD> mHud;
     std::unique_ptr<Camera> mCameraManager;
     std::unique_ptr<GameManager> mGameManager;
+    std::unique_ptr<LatencyTracker> mLatency; ///< Only with --latency-csv
+    std::unique_ptr<TelemetryRecorder> mTelemetry; ///< Only with --telemetry
+    std::uint64_t mTickCount = 0;
+    ScoreStore mScores{Config::SCORE_SNAPSHOT_FILE, Config::SCORE_LOG_FILE, Config::SCORE_TABLE_CAPACITY};
+
+    QualityGovernor mGovernor;
+    sf::RenderTexture mWorldTarget;  ///< Reduced-resolution world view (governor level > 0)
+    sf::Vector2u mWorldTargetSize;
+    bool mWorldTargetFailed = false; ///< Resize failed once: stay at full resolution
 
     bool mIsFullscreen;
     bool mHasFocus;
+    bool mMenuPacing = false; ///< Menu shown: reduced present rate
 };
 
 #endif // ENGINE_H
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef FRAMEPACER_H
+#define FRAMEPACER_H
+
+#include <SFML/System/Time.hpp>
+#include <chrono>
+
+/// @brief Presents frames at a fixed rate using hybrid sleep + spin-wait
+///
+/// Replaces RenderWindow::setFramerateLimit, whose plain sleep overshoots by
+/// a millisecond or more on Linux. The pacer sleeps until close to the deadline,
+/// then spins on steady_clock for the last stretch. The spin threshold adapts
+/// to the sleep overshoot it measures.
+class FramePacer {
+public:
+    /// @brief Pacing mode
+    enum class Mode {
+        Paced,    ///< Target the configured present rate
+        Uncapped, ///< No waiting at all (benchmarks, or when VSync paces us)
+        Menu,     ///< Sleep-only at Config::MENU_FRAME_RATE (static menu)
+        Idle      ///< Low-power: sleep-only at Config::IDLE_FRAME_RATE
+    };
+
+    /// @brief Constructor
+    /// @param targetRate Present rate in Hz (0 = uncapped)
+    explicit FramePacer(unsigned int targetRate);
+
+    /// @brief Change the present rate
+    /// @param targetRate Present rate in Hz (0 = uncapped)
+    void setTargetRate(unsigned int targetRate);
+
+    /// @brief Switch mode and resynchronize the deadline
+    /// @param mode New mode
+    void setMode(Mode mode);
+
+    /// @brief Restart the deadline and the frame-time measure from now
+    ///
+    /// Called after a long stall (loading): the next frame must not report it.
+    void resync();
+
+    /// @brief Get current mode
+    /// @return Active mode
+    Mode getMode() const;
+
+    /// @brief Block until the next present deadline
+    void waitForNextFrame();
+
+    /// @brief Real time between the last two waitForNextFrame() returns
+    /// @return Measured frame-to-frame time
+    sf::Time getFrameTime() const;
+
+    /// @brief Smoothed absolute deviation of the frame time from its period
+    /// @return Jitter in milliseconds
+    float getJitterMs() const;
+
+    /// @brief Snap a frame delta to a whole number of fixed steps when close to one
+    ///
+    /// Removes the 0/2-ticks-per-frame beat caused by tiny timing noise when the
+    /// present rate is a multiple of the physics rate. The snapped-off remainder
+    /// is carried over, so simulated time never drifts from real time.
+    /// @param frameTime Measured frame delta
+    /// @param step Fixed simulation step
+    /// @return Delta to feed the accumulator
+    sf::Time alignToStep(sf::Time frameTime, sf::Time step);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::duration currentPeriod() const;
+    void sleepUntil(Clock::time_point deadline, bool allowSpin);
+
+private:
+    Mode mMode;
+    Clock::duration mPeriod;            ///< Period of the Paced mode (zero = uncapped)
+    Clock::time_point mDeadline;        ///< Next present deadline
+    Clock::time_point mLastFrame;       ///< Last waitForNextFrame() return
+    Clock::duration mFrameTime;         ///< Last measured frame-to-frame time
+    Clock::duration mSpinThreshold;     ///< Time left before the deadline where we stop sleeping
+    float mJitterMs;
+    float mAlignDebt;                   ///< Seconds removed by alignToStep, to give back later
+};
+
+#endif // FRAMEPACER_H
@@ -28,14 +28,19 @@ public:
     }
 
     bool isEmpty() const { return mPoints.empty(); }
+
+    // Format de ghost.dat, partagé par le jeu, l'optimiseur et la carte de chaleur :
+    // float temps total, size_t nombre de points, puis les GhostPoint bruts
+    bool saveToFile(const std::string& path) const; // Fichier temporaire + renommage
+    bool loadFromFile(const std::string& path);     // Faux (et vide) si absent, tronqué ou incohérent
 };
 
 class GhostManager {
 public:
-    explicit GhostManager(AssetsManager& assets);
+    GhostManager(AssetsManager& assets, TextureHandle spriteAtlas); // Région Config::SPRITE_CAR
 
     void update(float dt, const Car& playerCar);
-    void render(sf::RenderWindow& window, bool isPlaying);
+    void render(SpriteBatch& batch, bool isPlaying) const;
 
     // Réinitialise l'état interne (accumulateurs)
     void reset();
@@ -47,14 +52,24 @@ public:
     bool handleLapComplete();
 
     float getBestLapTime() const;
+
+    // Copie du fantôme du dernier tour dans un fichier propre à l'entrée du classement ;
+    // vide si ce tour n'a pas battu le record
+    std::string saveLastReplay(const std::string& trackId) const;
+
+    // Pose courante du fantôme (minimap)
+    bool isGhostActive() const;
+    sf::Vector2f getGhostPosition() const;
+    float getGhostRotation() const;
     std::vector<sf::Time> getBestTimes() const;
 
 private:
-    void applyInterpolatedState(float time);
+    void applyInterpolatedState(const GhostData& ghost, float time);
+    const GhostData* getDisplayedGhost() const; // Fantôme du joueur, à défaut celui de référence
 
     // NOUVEAU : Persistance fichier
     void saveGhost();
-    void loadGhost();
+    bool loadGhost(const std::string& path, GhostData& ghost);
 
 private:
     AssetsManager& mAssets;
@@ -62,16 +77,16 @@ private:
 
     GhostData mBestGhost;
     GhostData mCurrentGhost;
+    GhostData mReferenceGhost; // Tour de l'optimiseur : affiché seulement sans fantôme du joueur, jamais un record
 
     bool mIsRecording; // Si on est autorisé à enregistrer
     bool mIsActive;    // NOUVEAU : Si la course a vraiment commencé (Timer lancé)
     bool mHasGhost;
+    bool mLastLapSaved = false;
 
     float mBestTime;
     float mCurrentLapTime;
     float mRecordAccumulator;
-
-    const std::string GHOST_FILE = "ghost.dat";
 };
 
 #endif
\ No newline at end of file
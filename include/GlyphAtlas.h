@@ -0,0 +1,68 @@
+#ifndef GLYPHATLAS_H
+#define GLYPHATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+
+/// @brief Pre-rasterized HUD glyphs taken from a single font page
+///
+/// Printable ASCII is loaded once at one character size, filled and outlined,
+/// so every HUD string samples the same texture and nothing is rasterized at
+/// run time. Digits share one advance (monospace) so a changing number never
+/// shifts its neighbours.
+class GlyphAtlas {
+public:
+    static constexpr char FIRST_CHAR = ' ';
+    static constexpr char LAST_CHAR = '~';
+
+    /// @brief Glyph quad relative to the pen on the baseline, at atlas size
+    struct Glyph {
+        sf::FloatRect bounds;   ///< Quad relative to the pen
+        sf::FloatRect texRect;  ///< Texture coordinates (pixels)
+        float advance = 0.f;    ///< Pen advance (digits use the widest digit)
+    };
+
+    /// @brief Constructor
+    /// @param font Loaded font (must outlive the atlas)
+    /// @param characterSize Rasterization size, scaled to every display size
+    /// @param outlineThickness Outline thickness at rasterization size
+    GlyphAtlas(const sf::Font& font, unsigned int characterSize, float outlineThickness);
+
+    /// @brief Get the filled glyph of a character (unknown characters map to '?')
+    const Glyph& getFill(char c) const;
+
+    /// @brief Get the outline glyph of a character
+    const Glyph& getOutline(char c) const;
+
+    /// @brief Copy the part of the font page holding the glyphs (for the sprite atlas)
+    /// @return Pixels from (0, 0) to the farthest glyph, white texel included
+    sf::Image copyPage() const;
+
+    /// @brief Sample the glyphs from a copy of the page placed in another texture
+    /// @param texture Texture holding the copy (must outlive the atlas)
+    /// @param offset Position of the copy in that texture
+    void relocate(const sf::Texture& texture, sf::Vector2f offset);
+
+    /// @brief Get the texture holding every glyph (font page, or the texture given to relocate)
+    const sf::Texture& getTexture() const;
+
+    /// @brief Get the texture coordinates of an opaque white texel (untextured quads)
+    sf::Vector2f getWhiteTexel() const;
+
+    unsigned int getCharacterSize() const;
+    float getLineSpacing() const;
+
+private:
+    static std::size_t index(char c);
+
+private:
+    const sf::Font& mFont;
+    const sf::Texture* mTexture = nullptr; ///< Set by relocate
+    sf::Vector2f mOffset;                  ///< Page origin in mTexture
+    unsigned int mCharacterSize;
+    float mLineSpacing;
+    std::array<Glyph, LAST_CHAR - FIRST_CHAR + 1> mFill;
+    std::array<Glyph, LAST_CHAR - FIRST_CHAR + 1> mOutline;
+};
+
+#endif // GLYPHATLAS_H
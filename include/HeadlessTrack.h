@@ -0,0 +1,51 @@
+#ifndef HEADLESSTRACK_H
+#define HEADLESSTRACK_H
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include "AssetsManager.h"
+#include "CollisionMask.h"
+#include "ThreadPool.h"
+#include "TrackCenterline.h"
+
+/// @brief Game track loaded without a window, for the command-line tools
+///
+/// Same assets as a game run: archive if present, HD/SD choice and mask
+/// decoding shared with World, world scale of World::finishLoading and the
+/// centerline cache of World::loadCenterline. Errors are reported on stderr,
+/// prefixed with the tool name.
+class HeadlessTrack {
+public:
+    /// @brief Constructor
+    /// @param tool Tool name used in error messages
+    explicit HeadlessTrack(std::string tool);
+
+    /// @brief Load and scale the collision mask, and read the car size
+    /// @param pool Workers classifying the mask
+    /// @return False if an asset is missing
+    bool load(ThreadPool& pool);
+
+    /// @brief Read the centerline cache, or build it (after load())
+    /// @param pool Workers running the thinning passes
+    /// @return False if no closed centerline was found
+    bool loadCenterline(ThreadPool& pool);
+
+    CollisionMask& getMask();                 ///< Scaled to world units
+    TrackCenterline& getCenterline();
+    const std::string& getMaskFilename() const;
+    std::string getCenterlineCachePath() const;
+    sf::Vector2u getCarSize() const;          ///< Car texture size (sets the bumpers tested by Car)
+    float getScale() const;                   ///< World units per mask pixel
+    sf::FloatRect getBounds() const;          ///< Track rectangle in world units (World::getTrackBounds)
+
+private:
+    std::string mTool;
+    AssetsManager mAssets;
+    CollisionMask mMask;
+    TrackCenterline mCenterline;
+    std::string mMaskFilename;
+    sf::Vector2u mCarSize;
+    float mScale = 1.f;
+};
+
+#endif // HEADLESSTRACK_H
@@ -2,11 +2,16 @@
 #define HUD_H
 
 #include <SFML/Graphics.hpp>
+#include <cstddef>
 #include <vector>
+#include "GlyphAtlas.h"
+#include "BitmapText.h"
 
 /// @brief Manages heads-up display
 class HUD {
 public:
+    static constexpr std::size_t MAX_BEST_TIMES = 5;
+
     /// @brief Constructor
     /// @param font Text font
     explicit HUD(const sf::Font& font);
@@ -23,18 +28,46 @@ public:
     void render(sf::RenderWindow& window);
 
     /// @brief Set best times display
-    /// @param times Best race times
+    /// @param times Best race times (the first MAX_BEST_TIMES are shown)
     void setBestTimes(const std::vector<sf::Time>& times);
     void updateFPS(float fps, const sf::Vector2u& windowSize);
 
+    /// @brief Show or hide the performance overlay
+    void toggleOverlay();
+
+    /// @brief Check if the performance overlay is shown
+    /// @return True if visible
+    bool isOverlayVisible() const;
+
+    /// @brief Refresh the frame-time graph and stats from the profiler
+    /// @param qualityLevel Current QualityGovernor level (0 = full quality)
+    void updateOverlay(std::size_t qualityLevel);
+
+    /// @brief Get the glyphs, to copy their page into the sprite atlas
+    const GlyphAtlas& getGlyphAtlas() const;
+
+    /// @brief Draw the text from the sprite atlas instead of the font page
+    /// @param texture Sprite atlas
+    /// @param glyphRegion Region holding GlyphAtlas::copyPage()
+    void useSpriteAtlas(const sf::Texture& texture, const sf::IntRect& glyphRegion);
+
 private:
-    sf::Text mSpeedText;        ///< Speed display
-    sf::Text mTimerText;        ///< Race timer display
-    sf::Text mCountdownText;    ///< Countdown display
-    std::vector<sf::Text> mBestTimesText; ///< Best times display
+    GlyphAtlas mAtlas;          ///< Glyphs rasterized once from the font
+    BitmapText mText;           ///< Every HUD string and the overlay graph, one draw call
+    std::size_t mSpeedField;    ///< Speed display
+    std::size_t mTimerField;    ///< Race timer display
+    std::size_t mCountdownField; ///< Countdown display
+    std::size_t mBestTimesFields[MAX_BEST_TIMES]; ///< Best times display
+    std::size_t mFpsField;
     int mLastCountdown = -99;
     int mLastSpeed = -1;
-    sf::Text mFpsText;
+    int mLastCentiseconds = -1;
+
+    std::size_t mOverlayQuad;      ///< Background, budget lines and 240 bars
+    std::size_t mOverlayField;     ///< min/avg/p99, ticks, pacer jitter, draw calls, terrain queries
+    std::size_t mOverlayFirstVertex; ///< The overlay is the tail of the vertex array
+    bool mShowOverlay = false;
+    int mOverlayTextCooldown = 0;  ///< Frames before the next text refresh
 };
 
 #endif // HUD_H
\ No newline at end of file
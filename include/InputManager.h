@@ -0,0 +1,94 @@
+#ifndef INPUTMANAGER_H
+#define INPUTMANAGER_H
+
+#include <SFML/Window.hpp>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "Car.h"
+#include "LatencyTracker.h"
+
+/// @brief Driving actions produced by the input layer
+enum class InputAction : std::uint8_t {
+    Accelerate,
+    Brake,
+    TurnLeft,
+    TurnRight,
+    Count
+};
+
+/// @brief Event-driven input state with a timestamped queue
+///
+/// Fed by KeyPressed/KeyReleased/Joystick* events from Engine::processEvents,
+/// so nothing is polled on the physics tick. Each fixed-step tick consumes
+/// only the transitions stamped before the end of its time window. A press
+/// released within the same window still drives that tick. A transition that
+/// does not change its source's state (OS key repeat) is ignored.
+class InputManager {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Constructor
+    InputManager();
+
+    /// @brief Queue the action transitions carried by an SFML event
+    /// @param event Polled event
+    /// @param timestamp Time the event was polled
+    void handleEvent(const sf::Event& event, Clock::time_point timestamp);
+
+    /// @brief Apply all queued transitions up to the end of a tick
+    /// @param tickEnd Wall-clock time matching the end of the simulated tick
+    /// @return Controls for this tick
+    CarControls consumeTick(Clock::time_point tickEnd);
+
+    /// @brief Release everything and drop the queue (focus lost)
+    void reset();
+
+    /// @brief Report every queued and consumed transition to a latency tracker
+    /// @param tracker Tracker, or nullptr to disable
+    void setLatencyTracker(LatencyTracker* tracker);
+
+private:
+    /// @brief Physical source of an action (several can hold the same action)
+    enum Source : std::uint8_t {
+        KeyPrimary,   ///< ZQSD
+        KeySecondary, ///< Arrow keys
+        JoyAxis,      ///< Stick X axis
+        JoyButtonA,   ///< Button 0 (accelerate) / button 1 (brake)
+        JoyButtonB,   ///< Button 2 (brake)
+        SourceCount
+    };
+
+    struct QueuedInput {
+        Clock::time_point timestamp;
+        InputAction action;
+        Source source;
+        bool pressed;
+        std::uint32_t latencyId; ///< Sample id in the LatencyTracker
+    };
+
+    static constexpr std::size_t QUEUE_CAPACITY = 128;
+    static constexpr unsigned int JOYSTICK_ID = 0;
+    static constexpr float JOYSTICK_DEADZONE = 40.f;
+
+    void handleKey(sf::Keyboard::Key key, bool pressed, Clock::time_point timestamp);
+    void handleJoystickButton(unsigned int button, bool pressed, Clock::time_point timestamp);
+    void handleJoystickAxis(float position, Clock::time_point timestamp);
+    void push(InputAction action, Source source, bool pressed, Clock::time_point timestamp);
+    void apply(const QueuedInput& input);
+    static std::uint32_t bit(InputAction action, Source source);
+    static std::uint32_t actionMask(InputAction action);
+
+private:
+    std::uint32_t mState;   ///< One bit per (action, source), current applied state
+    std::uint32_t mLatched; ///< Actions pressed at some point during the tick being consumed
+    std::uint32_t mQueuedState; ///< mState once every queued transition is applied (drops repeated presses)
+    std::array<QueuedInput, QUEUE_CAPACITY> mQueue; ///< Ring buffer, no allocation
+    std::size_t mHead;
+    std::size_t mCount;
+    int mAxisDirection;     ///< Last queued stick direction (-1, 0, 1), filters JoystickMoved spam
+    LatencyTracker* mLatency;
+};
+
+#endif // INPUTMANAGER_H
@@ -0,0 +1,66 @@
+#ifndef LATENCYTRACKER_H
+#define LATENCYTRACKER_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// @brief Input-to-photon latency measurement (enabled with --latency-csv)
+///
+/// Follows every input transition through three stamps:
+/// when it was polled, when the tick that fed it to Car::update ran,
+/// and when the first mWindow.display() after that tick returned.
+/// Reports min/p50/p95/p99/max on exit and dumps every sample to CSV.
+class LatencyTracker {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Constructor
+    /// @param csvPath Output file written by report()
+    explicit LatencyTracker(std::string csvPath);
+
+    /// @brief Register a polled input transition
+    /// @param timestamp Poll time
+    /// @return Sample id to carry with the input
+    std::uint32_t recordInput(Clock::time_point timestamp);
+
+    /// @brief The input was applied by the tick being consumed
+    /// @param id Sample id
+    void recordApplied(std::uint32_t id);
+
+    /// @brief The tick ran Car::update with the applied inputs
+    /// @param tickIndex Index of the fixed-step tick
+    /// @param tickEnd End of the tick window (wall-clock)
+    void commitTick(std::uint64_t tickIndex, Clock::time_point tickEnd);
+
+    /// @brief The tick did not reach Car::update (menu, countdown): drop its inputs
+    void discardTick();
+
+    /// @brief A frame was presented
+    /// @param alpha Render interpolation factor used for that frame
+    void recordPresent(float alpha);
+
+    /// @brief Print the distributions and write the CSV
+    void report() const;
+
+private:
+    struct Sample {
+        Clock::time_point input;
+        Clock::time_point tickEnd;
+        Clock::time_point tickRun;
+        Clock::time_point present;
+        std::uint64_t tick = 0;
+        float alpha = 0.f;
+        bool consumed = false;
+        bool presented = false;
+    };
+
+    std::string mCsvPath;
+    Clock::time_point mStart;
+    std::vector<Sample> mSamples;
+    std::vector<std::uint32_t> mApplied;        ///< Applied by the current tick
+    std::vector<std::uint32_t> mAwaitingPresent; ///< Consumed, not yet on screen
+};
+
+#endif // LATENCYTRACKER_H
@@ -0,0 +1,28 @@
+#ifndef LAUNCHOPTIONS_H
+#define LAUNCHOPTIONS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/// @brief Command-line options of the game executable
+struct LaunchOptions {
+    bool uncapped = false;   ///< --uncapped : no frame pacing, for benchmark runs
+    std::string latencyCsv;  ///< --latency-csv <file> : input-to-photon measurement mode
+    bool benchParticles = false; ///< --bench-particles : headless particle benchmark, then exit
+    bool benchVecEnv = false;    ///< --bench-vecenv : headless training environment throughput, then exit
+    std::string telemetryPath;   ///< --telemetry <file> : record per-tick car state
+    std::string telemetryDump;   ///< --telemetry-dump <file> : summarize a recording, then exit
+    std::vector<std::string> heatmapInputs; ///< --heatmap <file|dir> (repeatable) : laps aggregated into the heatmap
+    std::string heatmapOutput;   ///< --heatmap-out <png> : write the heatmap of the inputs, then exit
+    std::size_t aiDrivers = 0;   ///< --ai <n> : computer-driven opponents
+    std::size_t optimizeGenerations = 0; ///< --optimize-line <generations> : search the AI racing line, then exit
+
+    /// @brief Parse argv (unknown arguments are reported and ignored)
+    /// @param argc Argument count
+    /// @param argv Argument values
+    /// @return Parsed options
+    static LaunchOptions parse(int argc, char* argv[]);
+};
+
+#endif // LAUNCHOPTIONS_H
@@ -0,0 +1,38 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// @brief Read-only memory mapping of a whole file (mmap / MapViewOfFile)
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief Map a file, replacing any previous mapping
+    /// @param path File to map
+    /// @return True if mapped (empty files are not)
+    bool open(const std::string& path);
+
+    /// @brief Unmap the file
+    void close();
+
+    bool isOpen() const;
+    const std::uint8_t* data() const;
+    std::size_t size() const;
+
+private:
+    const std::uint8_t* mData = nullptr;
+    std::size_t mSize = 0;
+#ifdef _WIN32
+    void* mFile = nullptr;
+    void* mMapping = nullptr;
+#endif
+};
+
+#endif // MAPPEDFILE_H
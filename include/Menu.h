@@ -3,21 +3,30 @@
 
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include "Track.h"
+#include "ScoreStore.h"
 
 class Menu {
 public:
-    // On ajoute la texture de fond au constructeur
-    Menu(const sf::Font& font, const sf::Texture& bgTexture);
+    // Le fond est pris dans la pyramide LOD du circuit, au niveau adapté à la fenêtre
+    Menu(const sf::Font& font, const Track& track);
 
+    // Seul "Press Start" est dessiné à chaque frame, le reste vient du cache
     void render(sf::RenderWindow& window, bool showResult);
     void setResultText(const std::string& result);
 
-    // Met à jour l'affichage des scores
-    void updateHighScores();
+    // Met à jour l'affichage des scores (table déjà triée, aucune lecture disque)
+    void updateHighScores(const std::vector<ScoreEntry>& table);
 
 private:
+    // Recompose les couches statiques (fond, titre, scores, résultat)
+    void rebuildCache(sf::Vector2u windowSize, bool showResult);
+    void drawStaticLayers(sf::RenderTarget& target, bool showResult);
+    void layout(sf::Vector2u windowSize);
+
     // CORRECTION : On déclare mFont en premier pour correspondre à l'ordre d'initialisation
     const sf::Font& mFont;
+    const Track& mTrack;
 
     sf::Sprite mBackground;
     sf::Text mTitleText;
@@ -28,6 +37,13 @@ private:
     std::vector<sf::Text> mHighScoresList;
 
     sf::Clock mBlinkClock;
+
+    sf::RenderTexture mCache;     ///< Couches statiques composées
+    sf::Sprite mCacheSprite;
+    sf::Vector2u mCacheSize;      ///< Taille de fenêtre du dernier rebuild
+    bool mCacheShowsResult = false;
+    bool mCacheDirty = true;      ///< Scores ou résultat modifiés
+    bool mCacheValid = false;     ///< Échec de création : dessin direct
 };
 
 #endif // MENU_H
\ No newline at end of file
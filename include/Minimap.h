@@ -0,0 +1,62 @@
+#ifndef MINIMAP_H
+#define MINIMAP_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include "CollisionMask.h"
+#include "ThreadPool.h"
+
+/// @brief Live positions shown on the minimap (world coordinates)
+struct MinimapMarkers {
+    sf::Vector2f carPosition;
+    float carRotation = 0.f;
+    bool ghostVisible = false;
+    sf::Vector2f ghostPosition;
+    float ghostRotation = 0.f;
+    bool checkpointPassed = false;
+};
+
+/// @brief Small overview map built once from the terrain grid
+///
+/// The collision grid is max-pooled (walls win over lines, lines over road,
+/// road over grass) into a small RGBA texture at load, in parallel, so thin
+/// walls survive the downsample. Each frame only rewrites a few marker
+/// vertices; map and markers go out in one draw call.
+class Minimap {
+public:
+    /// @brief Constructor
+    /// @param mask Loaded collision mask
+    /// @param worldSize Track size in world units (covered by the mask)
+    /// @param threadPool Pool used for the downsample
+    Minimap(const CollisionMask& mask, sf::Vector2f worldSize, ThreadPool& threadPool);
+
+    /// @brief Draw the map at the bottom-left corner of the target (screen view)
+    /// @param target Render target
+    /// @param markers Car, ghost and checkpoint state
+    void render(sf::RenderTarget& target, const MinimapMarkers& markers);
+
+private:
+    void setTriangle(std::size_t first, sf::Vector2f center, float rotation, sf::Color color);
+    void setDiamond(std::size_t first, sf::Vector2f center, float radius, sf::Color color);
+    sf::Vector2f worldToMap(sf::Vector2f worldPos) const;
+
+private:
+    static constexpr std::size_t MAP_VERTEX = 0;
+    static constexpr std::size_t CHECKPOINT_VERTEX = 6;
+    static constexpr std::size_t FINISH_VERTEX = 12;
+    static constexpr std::size_t GHOST_VERTEX = 18;
+    static constexpr std::size_t CAR_VERTEX = 21;
+    static constexpr std::size_t VERTEX_COUNT = 24;
+
+    sf::Texture mTexture;        ///< Map, plus one white row for the markers
+    sf::Vector2u mMapSize;       ///< Map size in pixels (without the white row)
+    sf::Vector2f mWorldSize;
+    sf::Vector2f mOrigin{-1.f, -1.f}; ///< Top-left corner of the map on screen
+    sf::Vector2f mCheckpointCenter;
+    sf::Vector2f mFinishCenter;
+    bool mHasCheckpoint = false;
+    bool mHasFinish = false;
+    std::array<sf::Vertex, VERTEX_COUNT> mVertices;
+};
+
+#endif // MINIMAP_H
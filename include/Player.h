@@ -9,18 +9,21 @@
 class Player {
 public:
     /// @brief Constructor
-    /// @param carTexture Car texture
-    explicit Player(sf::Texture& carTexture);
+    /// @param carTexture Texture holding the car (sprite atlas)
+    /// @param carRect Car region in the texture
+    Player(sf::Texture& carTexture, const sf::IntRect& carRect);
 
     /// @brief Update player state
     /// @param deltaTime Time since last update
+    /// @param controls Inputs consumed for this tick
     /// @param bounds Track bounds
     /// @param mask Collision mask
-    void update(sf::Time deltaTime, const sf::FloatRect& bounds, const CollisionMask& mask);
+    void update(sf::Time deltaTime, const CarControls& controls, const sf::FloatRect& bounds, const CollisionMask& mask);
 
-    /// @brief Render player car
-    /// @param window Render target
-    void render(sf::RenderWindow& window, float alpha = 1.0f);
+    /// @brief Queue player car in the sprite batch
+    /// @param batch Sprite batch
+    /// @param alpha Interpolation factor between the last two ticks
+    void render(SpriteBatch& batch, float alpha = 1.0f) const;
 
     /// @brief Reset player state
     void reset();
@@ -0,0 +1,79 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Aggregated statistics over the frame history
+struct FrameStats {
+    float minMs = 0.f;          ///< Fastest frame
+    float avgMs = 0.f;          ///< Mean frame time
+    float p99Ms = 0.f;          ///< 99th percentile frame time
+    float maxMs = 0.f;          ///< Slowest frame
+    float stdDevMs = 0.f;       ///< Frame-time standard deviation (pacing quality)
+    unsigned int ticks = 0;     ///< Simulation ticks run during the last frame
+    unsigned int drawCalls = 0; ///< Draw calls submitted during the last frame
+    std::size_t vertices = 0;   ///< Vertices submitted during the last frame
+    float terrainQueriesPerTick = 0.f; ///< Terrain lookups per tick during the last frame
+    float workMs = 0.f;         ///< Last frame processing time, pacing wait excluded
+    float jitterMs = 0.f;       ///< Smoothed deviation from the pacer period (FramePacer::getJitterMs)
+};
+
+/// @brief Global per-frame performance counters
+///
+/// Static on purpose: the counters are bumped from every render
+/// and physics path without threading a reference through the whole tree.
+class Profiler {
+public:
+    static constexpr std::size_t HISTORY_SIZE = 240; ///< Frames kept for the graph
+
+    /// @brief Mark the start of the frame work (right after the pacing wait)
+    static void beginFrame();
+
+    /// @brief Close the current frame and push its duration into the history
+    /// @param frameTime Time elapsed since the previous frame
+    /// @param jitterMs Pacer jitter measured for this frame
+    static void endFrame(sf::Time frameTime, float jitterMs = 0.f);
+
+    /// @brief Mark the start of a fixed-step tick
+    static void beginTick();
+
+    /// @brief Mark the end of a fixed-step tick
+    static void endTick();
+
+    /// @brief Count one draw call
+    /// @param vertices Number of vertices submitted
+    static void countDrawCall(std::size_t vertices);
+
+    /// @brief Count the draw call of a text (6 vertices per glyph, doubled with outline)
+    /// @param text Text that was drawn
+    static void countText(const sf::Text& text);
+
+    /// @brief Count one terrain lookup (hot path, thread-local)
+    static void countTerrainQuery() { ++sTerrainQueries; }
+
+    /// @brief Count several terrain lookups at once (cells walked by a ray)
+    static void countTerrainQueries(std::uint32_t count) { sTerrainQueries += count; }
+
+    /// @brief Processing time of the last frame, without the pacing wait (cheap)
+    /// @return Milliseconds
+    static float getWorkMs();
+
+    /// @brief Compute min/avg/p99 over the history plus last-frame counters
+    /// @return Aggregated stats
+    static FrameStats getStats();
+
+    /// @brief Frame-time history in milliseconds (ring buffer)
+    /// @return Ring buffer, oldest sample at getHistoryHead()
+    static const std::array<float, HISTORY_SIZE>& getHistory();
+
+    /// @brief Index of the oldest sample in the history
+    static std::size_t getHistoryHead();
+
+private:
+    static inline thread_local std::uint32_t sTerrainQueries = 0;
+};
+
+#endif // PROFILER_H
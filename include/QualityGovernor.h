@@ -0,0 +1,51 @@
+#ifndef QUALITYGOVERNOR_H
+#define QUALITYGOVERNOR_H
+
+#include <array>
+#include <cstddef>
+
+/// @brief Rendering knobs driven by the quality governor
+struct QualitySettings {
+    float renderScale;       ///< World view resolution relative to the window
+    float particleFraction;  ///< Share of the particle pool allowed to live
+    bool showGhost;          ///< Draw the ghost car
+    int trackLodBias;        ///< Extra track LOD levels skipped
+};
+
+/// @brief Frame-time governor stepping quality down under load and back up with headroom
+///
+/// Fed with the frame work time (pacing wait excluded). A smoothed value over
+/// the budget for a while drops one level; a long stretch well below it raises
+/// one level. A cooldown after every change lets the new level settle, which
+/// keeps the governor from oscillating between two neighbours.
+class QualityGovernor {
+public:
+    static constexpr std::size_t LEVEL_COUNT = 4;
+
+    /// @brief Constructor
+    /// @param budgetMs Frame budget in milliseconds
+    explicit QualityGovernor(float budgetMs);
+
+    /// @brief Push the work time of the last frame
+    /// @param workMs Processing time in milliseconds
+    /// @return True if the level changed
+    bool update(float workMs);
+
+    /// @brief Get the settings of the current level
+    const QualitySettings& getSettings() const;
+
+    /// @brief Get the current level (0 = full quality)
+    std::size_t getLevel() const;
+
+private:
+    static const std::array<QualitySettings, LEVEL_COUNT> LEVELS;
+
+    float mBudgetMs;
+    float mAverageMs;      ///< Exponential moving average of the work time
+    std::size_t mLevel;
+    int mOverFrames;       ///< Consecutive frames over the budget
+    int mUnderFrames;      ///< Consecutive frames with headroom
+    int mCooldown;         ///< Frames left before the next change is allowed
+};
+
+#endif // QUALITYGOVERNOR_H
@@ -0,0 +1,76 @@
+#ifndef RACINGLINEOPTIMIZER_H
+#define RACINGLINEOPTIMIZER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "AIDrivers.h"
+#include "CollisionMask.h"
+#include "GhostManager.h"
+#include "ThreadPool.h"
+#include "TrackCenterline.h"
+
+/// @brief Offline search of the racing line driven by AIDrivers (--optimize-line)
+///
+/// A candidate is a set of lateral offsets at evenly spaced knots of the
+/// centerline (bounded by the measured track width) plus the corner margin of
+/// the speed profile. Each candidate is scored by simulating a timed lap with
+/// the real Car physics and CollisionMask, headless, from the player's start
+/// position. A generational genetic algorithm (elitism, two-point crossover,
+/// gaussian mutation with a decaying scale) evolves the population; every
+/// generation is evaluated across the thread pool, one AIDrivers per chunk.
+class RacingLineOptimizer {
+public:
+    /// @brief Constructor
+    /// @param mask Collision mask, scaled to world units
+    /// @param centerline Centerline of the same mask
+    /// @param carRect Car sprite region (its size sets the collision bumpers)
+    /// @param bounds World rectangle of the track (HeadlessTrack::getBounds)
+    /// @param pool Workers evaluating the candidates
+    RacingLineOptimizer(const CollisionMask& mask, const TrackCenterline& centerline, sf::IntRect carRect, sf::FloatRect bounds, ThreadPool& pool);
+
+    /// @brief Evolve the population
+    /// @param generations Number of generations
+    /// @return Best line found
+    TrackCenterline::RacingLine run(std::size_t generations);
+
+    /// @brief Simulate one lap and keep its poses, one per tick (reference ghost)
+    /// @param line Racing line
+    /// @return Poses from the start line to the finish, empty if the lap is not finished
+    std::vector<GhostPoint> recordLap(const TrackCenterline::RacingLine& line) const;
+
+    /// @brief Headless mode: optimize the line of the mask, write it to the centerline cache and the reference ghost
+    /// @param generations Number of generations
+    /// @return Process exit code
+    static int runTool(std::size_t generations);
+
+private:
+    struct Candidate {
+        std::vector<float> knots;
+        float cornerMargin = 0.f;
+        float fitness = 0.f;
+        float lapTime = 0.f;
+        bool evaluated = false;
+    };
+
+    void measureWidths();
+    void evaluate(std::vector<Candidate>& population);
+    void simulate(AIDrivers& driver, Candidate& candidate, std::vector<GhostPoint>* poses) const;
+    Candidate randomCandidate();
+    Candidate breed(const Candidate& a, const Candidate& b, float scale);
+
+private:
+    const CollisionMask& mMask;
+    const TrackCenterline& mCenterline;
+    sf::IntRect mCarRect;
+    sf::FloatRect mBounds;
+    ThreadPool& mPool;
+
+    std::vector<float> mMinOffset;  ///< Per knot, left bound (< 0)
+    std::vector<float> mMaxOffset;  ///< Per knot, right bound (> 0)
+    std::uint64_t mLaps = 0;        ///< Laps simulated (throughput report)
+    std::mt19937 mRandom;           ///< Seeded: runs are reproducible
+};
+
+#endif // RACINGLINEOPTIMIZER_H
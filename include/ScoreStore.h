@@ -0,0 +1,100 @@
+#ifndef SCORESTORE_H
+#define SCORESTORE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/// @brief One leaderboard line
+struct ScoreEntry {
+    float time = 0.f;            ///< Race time in seconds
+    std::uint64_t sequence = 0;  ///< Arrival order: ties keep the oldest first
+    std::string replay;          ///< Replay file of the run (empty if none)
+};
+
+/// @brief Per-track leaderboards kept sorted in memory, persisted in the background
+///
+/// Loaded once at startup from a snapshot plus an append-only log. A new time
+/// is placed by binary search (O(log n)) into a fixed-capacity sorted vector;
+/// the insertion then shifts the slower entries, O(n) moves bounded by
+/// SCORE_TABLE_CAPACITY (no reallocation, strings moved). Only the
+/// record is handed to a writer thread, which appends it to the log. Every
+/// few appends the writer rewrites the snapshot (temporary file + rename,
+/// so a crash never leaves a half-written table) and empties the log.
+/// Tables are read and written on the main thread only.
+class ScoreStore {
+public:
+    /// @brief Constructor (starts the writer thread, loads nothing)
+    /// @param snapshotPath Compacted tables
+    /// @param logPath Records appended since the last compaction
+    /// @param capacity Entries kept per track
+    ScoreStore(std::string snapshotPath, std::string logPath, std::size_t capacity);
+
+    /// @brief Write every queued record, then stop the writer
+    ~ScoreStore();
+
+    ScoreStore(const ScoreStore&) = delete;
+    ScoreStore& operator=(const ScoreStore&) = delete;
+
+    /// @brief Read the snapshot and replay the log (startup, any thread)
+    /// @param legacyTrack Track receiving the times of an old one-time-per-line scores file
+    void load(const std::string& legacyTrack);
+
+    /// @brief Insert a time and queue its persistence (never blocks on disk)
+    /// @param track Track identifier (no spaces)
+    /// @param time Race time in seconds
+    /// @param replay Replay file of the run, or empty
+    /// @return Rank in the table (0 = best), -1 if slower than a full table
+    int submit(const std::string& track, float time, const std::string& replay = "");
+
+    /// @brief Get the leaderboard of a track, best first
+    /// @param track Track identifier
+    /// @return Sorted entries (empty for an unknown track)
+    const std::vector<ScoreEntry>& getTable(const std::string& track) const;
+
+    /// @brief Block until every queued write is on disk
+    void flush();
+
+private:
+    struct Job {
+        bool compact = false;
+        std::string track;     ///< Append: record to write
+        ScoreEntry entry;
+        std::string snapshot;  ///< Compact: tables already formatted
+        std::uint64_t lastSequence = 0;
+    };
+
+    int insert(const std::string& track, ScoreEntry entry);
+    std::string formatTables() const;
+    static std::string formatRecord(const std::string& track, const ScoreEntry& entry);
+    bool parseRecord(const std::string& line, std::string& track, ScoreEntry& entry) const;
+    void enqueue(Job job);
+    void writerLoop();
+    void write(const Job& job);
+
+private:
+    std::string mSnapshotPath;
+    std::string mLogPath;
+    std::size_t mCapacity;
+    std::unordered_map<std::string, std::vector<ScoreEntry>> mTables;
+    std::uint64_t mNextSequence = 1;
+    unsigned int mAppendsSinceCompaction = 0;
+
+    std::ofstream mLog;              ///< Writer thread only
+    std::deque<Job> mJobs;
+    bool mWriting = false;           ///< A job is being written
+    bool mStopping = false;
+    std::mutex mMutex;
+    std::condition_variable mWake;   ///< Writer: job queued or stop
+    std::condition_variable mIdle;   ///< flush(): queue drained
+    std::thread mWriter;             ///< Declared last: starts once everything above exists
+};
+
+#endif // SCORESTORE_H
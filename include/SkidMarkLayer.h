@@ -0,0 +1,70 @@
+#ifndef SKIDMARKLAYER_H
+#define SKIDMARKLAYER_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Car.h"
+
+/// @brief Mark state of one car between ticks
+struct SkidTrail {
+    std::array<sf::Vector2f, 2> lastWheels; ///< Rear wheel positions on the previous tick
+    bool active = false;                    ///< Was the car marking on the previous tick
+};
+
+/// @brief Tire marks accumulated in off-screen render textures
+///
+/// Marks are stamped once per tick into track-space tiles (allocated on first
+/// use) instead of being kept as geometry. Only tiles touched since the last
+/// frame are redrawn (dirty path). Ageing subtracts a constant opacity from
+/// every marked tile on its own SKID_FADE_INTERVAL schedule, so marks reach
+/// zero in a fixed time, with no per-mark bookkeeping. Drawing costs one textured
+/// quad per allocated tile, however long the session.
+class SkidMarkLayer {
+public:
+    /// @brief Constructor
+    /// @param worldSize Track size in world units
+    explicit SkidMarkLayer(sf::Vector2f worldSize);
+
+    /// @brief Stamp the rear wheel segments of a sliding car
+    /// @param trail Mark state of that car
+    /// @param car Source car
+    void stampFromCar(SkidTrail& trail, const Car& car);
+
+    /// @brief Advance the fade timers of the marked tiles
+    /// @param dt Tick duration in seconds
+    void update(float dt);
+
+    /// @brief Apply pending stamps/fades, then draw the tiles intersecting the view
+    /// @param target Render target
+    /// @param viewRect Visible area in world coordinates
+    void render(sf::RenderTarget& target, const sf::FloatRect& viewRect);
+
+    /// @brief Erase every mark
+    void clear();
+
+private:
+    struct Tile {
+        std::unique_ptr<sf::RenderTexture> texture; ///< Allocated on first stamp
+        std::vector<sf::Vertex> pending;            ///< Stamps not yet drawn into the texture
+        bool fadePending = false;
+        float fadeTimer = 0.f;                      ///< Time since the last fade of this tile
+        unsigned int fadesLeft = 0;                 ///< Fades before the tile is surely empty (0 = nothing to fade)
+    };
+
+    void stampSegment(sf::Vector2f from, sf::Vector2f to);
+    Tile& tileAt(unsigned int tx, unsigned int ty);
+    sf::FloatRect tileWorldRect(unsigned int tx, unsigned int ty) const;
+    void flush();
+
+private:
+    sf::Vector2f mWorldSize;
+    float mTileWorldSize;          ///< Tile side in world units
+    sf::Vector2u mTileCount;
+    std::vector<Tile> mTiles;
+    std::vector<std::size_t> mDirtyTiles;
+};
+
+#endif // SKIDMARKLAYER_H
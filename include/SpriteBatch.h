@@ -0,0 +1,59 @@
+#ifndef SPRITEBATCH_H
+#define SPRITEBATCH_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+/// @brief Collects textured quads and submits them in as few draw calls as possible
+///
+/// Quads are sorted by (layer, texture, blend mode), keeping submission order
+/// inside a group. Each group becomes one vertex array draw, so the draw call
+/// count stays constant however many cars, ghosts or effects share a texture.
+class SpriteBatch {
+public:
+    /// @brief Draw order of the gameplay layers
+    enum Layer : std::uint8_t {
+        LayerGround = 0,   ///< Marks on the track
+        LayerCars = 1      ///< Ghost, player and opponents (ghost submitted first, drawn below)
+    };
+
+    /// @brief Constructor
+    SpriteBatch();
+
+    /// @brief Queue a textured quad
+    /// @param texture Texture sampled by the quad
+    /// @param textureRect Source rectangle in the texture (also the local size of the quad)
+    /// @param transform Local-to-world transform
+    /// @param color Vertex color (tint)
+    /// @param layer Draw order group
+    /// @param blendMode Blend mode of the quad
+    void draw(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::Transform& transform,
+              sf::Color color = sf::Color::White, std::uint8_t layer = LayerCars,
+              const sf::BlendMode& blendMode = sf::BlendAlpha);
+
+    /// @brief Queue a sprite with its current transform, rect and color
+    /// @param sprite Sprite to copy
+    /// @param layer Draw order group
+    void draw(const sf::Sprite& sprite, std::uint8_t layer = LayerCars);
+
+    /// @brief Sort and submit everything queued, then clear
+    /// @param target Render target
+    void flush(sf::RenderTarget& target);
+
+private:
+    struct Quad {
+        std::uint64_t key;          ///< layer | blend | submission index, for sorting
+        const sf::Texture* texture;
+        sf::Vertex vertices[6];
+    };
+
+    std::uint8_t blendIndex(const sf::BlendMode& blendMode);
+
+private:
+    std::vector<Quad> mQuads;              ///< Reused between frames
+    std::vector<sf::BlendMode> mBlendModes;
+    sf::VertexArray mVertices;             ///< Reused between frames
+};
+
+#endif // SPRITEBATCH_H
@@ -0,0 +1,102 @@
+#ifndef STARTUPPIPELINE_H
+#define STARTUPPIPELINE_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+#include "ThreadPool.h"
+
+/// @brief Dependency graph of load tasks driven from the main loop
+///
+/// Worker tasks (decodes, classification) are submitted to the thread pool
+/// as soon as their dependencies are done. Main-thread tasks (GPU uploads,
+/// object creation) run in a batch from poll(), so the caller can render a
+/// loading screen between two polls. A failed task stops its dependents.
+class StartupPipeline {
+public:
+    using TaskId = std::size_t;
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Where a task runs
+    enum class Thread { Worker, Main };
+
+    /// @brief Result of one run of a task
+    enum class Status {
+        Done,
+        Again,  ///< Main-thread tasks only: run again on the next poll
+        Failed
+    };
+
+    /// @brief Constructor
+    /// @param pool Workers running the Worker tasks
+    explicit StartupPipeline(ThreadPool& pool);
+
+    /// @brief Wait for the worker tasks still running (they reference the caller's objects)
+    ~StartupPipeline();
+
+    StartupPipeline(const StartupPipeline&) = delete;
+    StartupPipeline& operator=(const StartupPipeline&) = delete;
+
+    /// @brief Declare a task (all tasks must be declared before the first poll)
+    /// @param name Label shown on the loading screen and in the timings
+    /// @param thread Where the task runs
+    /// @param dependencies Tasks that must be done first
+    /// @param work Task body; exceptions count as a failure
+    /// @return Task id
+    TaskId addTask(std::string name, Thread thread, std::vector<TaskId> dependencies, std::function<Status()> work);
+
+    /// @brief Start ready worker tasks, collect finished ones and run ready main-thread tasks
+    void poll();
+
+    /// @brief Start nothing more; isFinished() turns true once the running worker tasks return
+    void cancel();
+
+    /// @brief Check if nothing is running and nothing more can start
+    bool isFinished() const;
+
+    /// @brief Check if a task failed
+    bool hasFailed() const;
+
+    /// @brief Error of the first failed task
+    const std::string& getError() const;
+
+    /// @brief Fraction of tasks done
+    float getProgress() const;
+
+    /// @brief Name of a task currently running (or the last started)
+    const std::string& getCurrentLabel() const;
+
+    /// @brief Print the duration of every task
+    void printTimings() const;
+
+private:
+    enum class State { Waiting, Running, Done, Failed };
+
+    struct Task {
+        std::string name;
+        Thread thread;
+        std::vector<TaskId> dependencies;
+        std::function<Status()> work;
+        State state = State::Waiting;
+        std::future<Status> result;
+        Clock::time_point start;
+        Clock::time_point end;
+    };
+
+    bool isReady(const Task& task) const;
+    void finish(Task& task, Status status, const std::string& error = std::string());
+
+private:
+    ThreadPool& mPool;
+    std::vector<Task> mTasks;
+    std::size_t mDone;
+    std::string mError;
+    std::string mCurrentLabel;
+    Clock::time_point mStart;
+    bool mCancelled;
+};
+
+#endif // STARTUPPIPELINE_H
@@ -0,0 +1,63 @@
+#ifndef TELEMETRYREADER_H
+#define TELEMETRYREADER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+#include "TelemetryRecorder.h"
+
+/// @brief Memory-mapped reader of a telemetry file
+///
+/// Opening only walks the chunk headers; columns are decoded on request,
+/// straight from the mapping into the caller's buffer, one column at a time.
+/// Indexing stops at the first truncated or inconsistent chunk (more rows
+/// than TELEMETRY_CHUNK_TICKS or than encoded bytes), so decode never sizes a
+/// buffer from a corrupted header.
+class TelemetryReader {
+public:
+    /// @brief One chunk of the file (pointers into the mapping)
+    struct Chunk {
+        std::uint64_t firstTick = 0;
+        std::uint32_t rows = 0;
+        const std::uint8_t* columns[TelemetryFormat::ColumnCount] = {};
+        std::uint32_t columnBytes[TelemetryFormat::ColumnCount] = {};
+    };
+
+    /// @brief Map a telemetry file and index its chunks
+    /// @param path File written by TelemetryRecorder
+    /// @return True if the header is valid
+    bool open(const std::string& path);
+
+    const std::vector<Chunk>& getChunks() const;
+    std::uint64_t getTickCount() const;
+
+    /// @brief Decode a float column of one chunk
+    /// @param chunk Chunk index
+    /// @param column Column below FIRST_INTEGER_COLUMN
+    /// @param out Receives Chunk::rows values (reused between calls)
+    /// @return False if the column is damaged
+    bool readFloats(std::size_t chunk, TelemetryFormat::Column column, std::vector<float>& out) const;
+
+    /// @brief Decode an integer column of one chunk
+    /// @param chunk Chunk index
+    /// @param column Column from FIRST_INTEGER_COLUMN on
+    /// @param out Receives Chunk::rows values (reused between calls)
+    /// @return False if the column is damaged
+    bool readIntegers(std::size_t chunk, TelemetryFormat::Column column, std::vector<std::uint32_t>& out) const;
+
+    /// @brief Print a per-column summary of a file (--telemetry-dump)
+    /// @param path Telemetry file
+    /// @return Process exit code
+    static int dump(const std::string& path);
+
+private:
+    bool decode(std::size_t chunk, TelemetryFormat::Column column, std::vector<std::uint32_t>& out) const;
+
+private:
+    MappedFile mFile;
+    std::vector<Chunk> mChunks;
+    std::uint64_t mTickCount = 0;
+};
+
+#endif // TELEMETRYREADER_H
@@ -0,0 +1,151 @@
+#ifndef TELEMETRYRECORDER_H
+#define TELEMETRYRECORDER_H
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// @brief On-disk layout of a telemetry file (*.rrt)
+///
+/// Header, then chunks appended one after the other. A chunk holds up to
+/// Config::TELEMETRY_CHUNK_TICKS consecutive ticks stored column by column:
+/// floats as varint(bits XOR previous bits), integers as varint(zigzag(delta)).
+/// Values restart from zero at each chunk, so any chunk decodes on its own.
+/// A truncated last chunk (crash) is skipped by the reader. Little-endian only.
+namespace TelemetryFormat {
+    inline constexpr char MAGIC[8] = {'R', 'R', 'T', 'L', 'M', '0', '1', '\0'};
+    inline constexpr std::uint32_t CHUNK_MAGIC = 0x4B4E4843; // "CHNK"
+
+    /// @brief Recorded columns, in file order
+    enum Column : std::uint32_t {
+        PositionX, PositionY, VelocityX, VelocityY, Heading, Steer, Grass, // float
+        Terrain, Inputs,                                                   // integer
+        ColumnCount
+    };
+    inline constexpr std::uint32_t FIRST_INTEGER_COLUMN = Terrain;
+
+    // Bits of the Inputs column
+    inline constexpr std::uint8_t INPUT_ACCELERATE = 1;
+    inline constexpr std::uint8_t INPUT_BRAKE = 2;
+    inline constexpr std::uint8_t INPUT_LEFT = 4;
+    inline constexpr std::uint8_t INPUT_RIGHT = 8;
+
+    struct Header {
+        char magic[8];
+        std::uint32_t columnCount;
+        std::uint32_t reserved;
+    };
+
+    struct ChunkHeader {
+        std::uint32_t magic;
+        std::uint32_t rowCount;
+        std::uint64_t firstTick;
+        std::uint32_t columnBytes[ColumnCount]; ///< Encoded size of each column, in order after the header
+        std::uint32_t reserved;
+    };
+
+    /// @brief Append a LEB128 varint (7 bits per byte, small values in one byte)
+    inline void appendVarint(std::vector<std::uint8_t>& out, std::uint32_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    /// @brief Read a LEB128 varint
+    /// @return False if the data ends inside the varint
+    inline bool readVarint(const std::uint8_t*& data, const std::uint8_t* end, std::uint32_t& value) {
+        value = 0;
+        for (unsigned int shift = 0; data < end && shift < 35; shift += 7) {
+            std::uint8_t byte = *data++;
+            value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) return true;
+        }
+        return false;
+    }
+
+    /// @brief Map signed deltas to small unsigned values (0, -1, 1, -2... -> 0, 1, 2, 3...)
+    inline std::uint32_t zigzag(std::int32_t value) {
+        return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+    }
+
+    inline std::int32_t unzigzag(std::uint32_t value) {
+        return static_cast<std::int32_t>(value >> 1) ^ -static_cast<std::int32_t>(value & 1);
+    }
+}
+
+/// @brief Car state of one tick
+struct TelemetrySample {
+    float position[2] = {0.f, 0.f};
+    float velocity[2] = {0.f, 0.f};
+    float heading = 0.f;          ///< Degrees
+    float steer = 0.f;            ///< Car::mCurrentSteer
+    float grass = 0.f;            ///< Car::mGrassIntensity
+    std::uint8_t terrain = 0;     ///< TerrainType under the car
+    std::uint8_t inputs = 0;      ///< TelemetryFormat::INPUT_* bits
+};
+
+/// @brief Records one sample per tick into preallocated column buffers
+///
+/// record() only stores the values in the current chunk; a full chunk is
+/// handed to a writer thread that encodes and appends it. Chunk buffers are
+/// allocated once and recycled; if the writer falls behind, the chunk is
+/// dropped (and counted) rather than stalling the tick.
+class TelemetryRecorder {
+public:
+    /// @brief Constructor (creates the file and starts the writer)
+    /// @param path Output file
+    explicit TelemetryRecorder(std::string path);
+
+    /// @brief Write the partial chunk, then stop the writer
+    ~TelemetryRecorder();
+
+    TelemetryRecorder(const TelemetryRecorder&) = delete;
+    TelemetryRecorder& operator=(const TelemetryRecorder&) = delete;
+
+    /// @brief Store the sample of a tick (main thread, no allocation)
+    /// @param tick Tick index
+    /// @param sample Car state
+    void record(std::uint64_t tick, const TelemetrySample& sample);
+
+    /// @brief Check if the output file could be created
+    bool isOpen() const;
+
+private:
+    /// @brief Column buffers of one chunk
+    struct Chunk {
+        std::uint64_t firstTick = 0;
+        std::uint32_t rows = 0;
+        std::array<std::vector<std::uint32_t>, TelemetryFormat::ColumnCount> columns; ///< Raw bits, one value per row
+    };
+
+    void submit();
+    void writerLoop();
+    void encode(const Chunk& chunk);
+
+private:
+    std::string mPath;
+    std::ofstream mFile;                        ///< Writer thread only after construction
+    std::vector<std::unique_ptr<Chunk>> mChunks; ///< Every buffer, allocated once
+    Chunk* mCurrent = nullptr;                  ///< Filled by record()
+    std::vector<Chunk*> mFree;                  ///< Ready to be filled
+    std::vector<Chunk*> mFull;                  ///< Waiting for the writer, oldest first
+    std::vector<std::uint8_t> mEncoded;         ///< Writer scratch buffer
+    std::uint64_t mRecorded = 0;
+    std::uint64_t mDropped = 0;
+    std::uint64_t mBytesWritten = 0;
+    bool mStopping = false;
+    bool mOpen = false;                         ///< Header written at construction (read by isOpen on any thread)
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::thread mWriter;                        ///< Declared last: starts once everything above exists
+};
+
+#endif // TELEMETRYRECORDER_H
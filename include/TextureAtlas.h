@@ -0,0 +1,75 @@
+#ifndef TEXTUREATLAS_H
+#define TEXTUREATLAS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Packs several images into one texture with a skyline packer
+///
+/// Images are queued on the CPU, packed tallest first at the lowest point of
+/// the skyline, then uploaded once, smoothed and mipmapped: the HUD glyphs
+/// (rasterized at 64 px) and the car are drawn much smaller than their source.
+/// Every region is surrounded by a copy of its own border pixels so rotated
+/// or scaled sprites never sample a neighbour. Sprites sharing the
+/// atlas share one texture, so SpriteBatch merges them.
+class TextureAtlas {
+public:
+    /// @brief Constructor
+    /// @param maxSize Largest side accepted for the atlas
+    explicit TextureAtlas(unsigned int maxSize);
+
+    /// @brief Queue an image (replaces a previous image of the same name)
+    /// @param name Region name
+    /// @param pixels RGBA8 pixels, copied
+    /// @param size Image size
+    void add(const std::string& name, const std::uint8_t* pixels, sf::Vector2u size);
+
+    /// @brief Pack the queued images into one image (CPU only, any thread)
+    /// @return True if everything fits in maxSize x maxSize
+    bool pack();
+
+    /// @brief Upload the packed image and release the CPU copies (main thread)
+    /// @param texture Destination texture
+    /// @return True if uploaded
+    bool upload(sf::Texture& texture);
+
+    /// @brief Find a packed region
+    /// @param name Region name
+    /// @return Region in atlas pixels, or nullptr if unknown
+    const sf::IntRect* find(const std::string& name) const;
+
+    /// @brief Get the atlas size once packed
+    sf::Vector2u getSize() const;
+
+private:
+    struct Source {
+        std::string name;
+        sf::Vector2u size;
+        std::vector<std::uint8_t> pixels;
+    };
+
+    /// @brief Horizontal segment of the skyline (top of the packed area)
+    struct SkylineNode {
+        unsigned int x;
+        unsigned int y;
+        unsigned int width;
+    };
+
+    bool tryPack(sf::Vector2u atlasSize);
+    bool findPosition(unsigned int width, unsigned int height, unsigned int atlasHeight, std::size_t& node, unsigned int& y) const;
+    void insertNode(std::size_t node, unsigned int x, unsigned int y, unsigned int width);
+    void blit(const Source& source, sf::Vector2u position);
+
+private:
+    unsigned int mMaxSize;
+    std::vector<Source> mSources;
+    std::vector<SkylineNode> mSkyline;
+    std::unordered_map<std::string, sf::IntRect> mRegions;
+    sf::Vector2u mSize;
+    std::vector<std::uint8_t> mPixels;
+};
+
+#endif // TEXTUREATLAS_H
@@ -0,0 +1,116 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/// @brief Fixed set of worker threads consuming a FIFO of jobs
+class ThreadPool {
+public:
+    /// @brief Constructor
+    /// @param threadCount Number of workers (0 = one less than the hardware threads, at least 1)
+    explicit ThreadPool(unsigned int threadCount = 0);
+
+    /// @brief Finish queued jobs and join the workers
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// @brief Queue a job
+    /// @param job Callable run on a worker
+    /// @return Future holding the job result
+    template <class F>
+    std::future<std::invoke_result_t<F>> submit(F&& job) {
+        using Result = std::invoke_result_t<F>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(job));
+        std::future<Result> future = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return future;
+    }
+
+    /// @brief Split [0, count) in contiguous chunks and run body(begin, end) on all threads
+    ///
+    /// The calling thread takes a chunk too, then runs queued jobs while it
+    /// waits, so it is safe to call from a worker (startup tasks do).
+    /// @param count Number of items
+    /// @param body Callable taking (std::size_t begin, std::size_t end)
+    template <class F>
+    void parallelFor(std::size_t count, F&& body) {
+        if (count == 0) return;
+        std::size_t chunks = std::min<std::size_t>(count, mWorkers.size() + 1);
+        std::size_t chunkSize = (count + chunks - 1) / chunks;
+
+        std::vector<std::future<void>> pending;
+        pending.reserve(chunks);
+        for (std::size_t begin = chunkSize; begin < count; begin += chunkSize) {
+            std::size_t end = std::min(begin + chunkSize, count);
+            pending.push_back(submit([&body, begin, end]() { body(begin, end); }));
+        }
+
+        body(std::size_t(0), std::min(chunkSize, count));
+        for (auto& f : pending) {
+            while (f.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                if (!runPendingJob()) std::this_thread::yield();
+            }
+            f.get();
+        }
+    }
+
+    /// @brief Same split as parallelFor, without any allocation (hot loops stepped every tick)
+    ///
+    /// The chunks are published in fixed members of the pool instead of queued
+    /// jobs: workers claim them under the pool mutex, the calling thread claims
+    /// the rest, then waits for the chunks still running. One batch at a time;
+    /// body must not throw nor call dispatch() itself.
+    /// @param count Number of items
+    /// @param body Callable taking (std::size_t begin, std::size_t end), kept alive by the caller
+    template <class F>
+    void dispatch(std::size_t count, F&& body) {
+        using Body = std::remove_reference_t<F>;
+        runBatch(count, [](void* context, std::size_t begin, std::size_t end) { (*static_cast<Body*>(context))(begin, end); },
+                 const_cast<void*>(static_cast<const void*>(&body)));
+    }
+
+    /// @brief Get worker count
+    /// @return Number of worker threads
+    unsigned int getThreadCount() const;
+
+private:
+    using BatchInvoke = void (*)(void* context, std::size_t begin, std::size_t end);
+
+    void enqueue(std::function<void()> job);
+    void runBatch(std::size_t count, BatchInvoke invoke, void* context);
+    bool claimBatchChunk(std::size_t& begin, std::size_t& end); ///< Under mMutex, false if none left
+    bool runPendingJob(); ///< Run one queued job on the calling thread, false if none
+    void workerLoop();
+
+private:
+    std::vector<std::thread> mWorkers;
+    std::deque<std::function<void()>> mJobs;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStopping;
+
+    // Lot de dispatch() : champs fixes, protégés par mMutex (aucune allocation par appel)
+    std::mutex mBatchCaller;                 ///< Un seul lot à la fois
+    std::condition_variable mBatchDone;
+    BatchInvoke mBatchInvoke = nullptr;
+    void* mBatchContext = nullptr;
+    std::size_t mBatchCount = 0;
+    std::size_t mBatchChunkSize = 0;
+    std::size_t mBatchNext = 0;              ///< Début du prochain morceau à prendre
+    std::size_t mBatchRunning = 0;           ///< Morceaux pris par les workers et pas encore finis
+};
+
+#endif // THREADPOOL_H
@@ -2,22 +2,139 @@
 #define TRACK_H
 
 #include <SFML/Graphics.hpp>
-// #include "Entity.h" <-- Supprimé
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.h"
+#include "ThreadPool.h"
 
-// Track n'hérite plus de Entity
+/// @brief Circuit background streamed as fixed-size GPU tiles from a LOD pyramid
+///
+/// Every level of the pyramid is stored tile by tile in the on-disk LOD cache,
+/// which is memory-mapped: the source image is only decoded when that cache is
+/// missing or stale, and the full-resolution pixels are never held in the
+/// heap. Tile jobs on the thread pool read their tile from the mapping (the
+/// disk reads happen there); the main thread only does the GPU upload. Tiles
+/// around the camera live in an LRU of textures that grows to the visible tile
+/// count, so circuits larger than sf::Texture::getMaximumSize() work with
+/// bounded VRAM. The level is chosen from the texel-to-pixel ratio of the view.
 class Track {
 public:
-    explicit Track(sf::Texture& texture);
+    /// @brief Constructor
+    /// @param pool Workers used to build levels and prepare tiles
+    explicit Track(ThreadPool& pool);
 
-    // Retrait de 'override' car Entity n'existe plus
-    void render(sf::RenderWindow& window);
+    /// @brief Wait for in-flight tile jobs
+    ~Track();
+
+    /// @brief Open or build the tile store of an image file, and create the textures
+    /// @param path Image file
+    /// @return True if loaded
+    bool loadFromFile(const std::string& path);
+
+    /// @brief CPU half of loadFromFile: tile store, decoding the image only on a cache miss (any thread, no GPU work)
+    /// @param path Image file
+    /// @return True if loaded
+    bool decodeFromFile(const std::string& path);
+
+    /// @brief Same as decodeFromFile, from pixels already decoded (packed archive)
+    /// @param pixels RGBA8 pixels
+    /// @param size Image size
+    /// @param name Source name, used for the LOD cache file
+    /// @param sourceKey Changes whenever the pixels do (LOD cache invalidation)
+    /// @return True if loaded
+    bool decodeFromPixels(const std::uint8_t* pixels, sf::Vector2u size, const std::string& name, std::uint64_t sourceKey);
+
+    /// @brief Same as decodeFromFile, from an encoded image in memory (packed archive, large PNG)
+    /// @param data Encoded image (PNG...)
+    /// @param size Size of data in bytes
+    /// @param name Source name, used for the LOD cache file
+    /// @param sourceKey Changes whenever the data does (LOD cache invalidation)
+    /// @return True if loaded
+    bool decodeFromMemory(const std::uint8_t* data, std::size_t size, const std::string& name, std::uint64_t sourceKey);
+
+    /// @brief GPU half of loadFromFile: tile table and preview textures (main thread)
+    void createTextures();
+
+    /// @brief Draw the tiles intersecting the view, at the level matching its zoom
+    /// @param target Render target (its current view gives the pixel density)
+    /// @param viewRect Visible area in world coordinates
+    void render(sf::RenderTarget& target, const sf::FloatRect& viewRect);
 
     sf::FloatRect getGlobalBounds() const;
 
     void setScale(float scale);
 
+    /// @brief Draw coarser levels than the zoom calls for (quality governor)
+    /// @param bias Extra levels to skip (0 = exact)
+    void setLodBias(int bias);
+
+    /// @brief Get source image size
+    /// @return Size in pixels
+    sf::Vector2u getImageSize() const;
+
+    /// @brief Whole-circuit texture of the smallest level still covering a target size
+    /// @param targetSize Size in pixels the texture will be drawn at
+    /// @return Level texture (only small levels have one)
+    const sf::Texture& getPreviewTexture(sf::Vector2u targetSize) const;
+
 private:
-    sf::Sprite mSprite;
+    /// @brief One level of the pyramid (level 0 = source image)
+    struct Level {
+        sf::Vector2u size;
+        sf::Vector2u tileCount;
+        int firstTile = 0;                    ///< Global index of its first tile
+        std::unique_ptr<sf::Texture> whole;   ///< Whole-level texture for small levels
+    };
+
+    /// @brief CPU pixels of one tile, produced by a worker
+    struct TilePixels {
+        int tile = -1;
+        sf::Vector2u size;
+        std::vector<std::uint8_t> pixels;
+    };
+
+    /// @brief One GPU texture of the LRU
+    struct CachedTile {
+        sf::Texture texture;
+        int tile = -1;              ///< Global tile index held (-1 = free)
+        sf::Vector2u size;          ///< Used part of the texture (edge tiles are smaller)
+        std::uint64_t lastUsed = 0; ///< Frame of last draw
+    };
+
+    bool openStore(const std::string& name, std::uint64_t sourceKey, sf::Vector2u sourceSize);
+    void buildStore(const std::uint8_t* pixels, sf::Vector2u size, const std::string& name, std::uint64_t sourceKey);
+    void setupLevels(sf::Vector2u sourceSize);
+    std::string cachePathOf(const std::string& name) const;
+    int levelOfTile(int tile) const;
+    sf::Vector2u tileSizeOf(int tile) const;
+    int selectLevel(const sf::RenderTarget& target, const sf::FloatRect& viewRect) const;
+
+    TilePixels extractTile(int tile) const;
+    void requestTile(int tile);
+    int makeResident(int tile);
+    void upload(TilePixels&& pixels);
+    void collectReadyTiles();
+
+private:
+    ThreadPool& mPool;
+    std::vector<Level> mLevels;
+    float mScale;
+    int mLodBias;
+
+    unsigned int mTileSize;
+    std::vector<std::uint64_t> mTileOffset; ///< Global tile index -> offset of its pixels in the store
+    MappedFile mStoreFile;                  ///< LOD cache, mapped
+    std::vector<std::uint8_t> mStoreMemory; ///< Same layout, when the cache cannot be written
+    const std::uint8_t* mStore;             ///< Tile pixels (mapping or mStoreMemory)
+
+    std::vector<int> mTileSlot;             ///< Global tile index -> cache slot (-1 = not resident)
+    std::vector<CachedTile> mCache;
+    std::unordered_map<int, std::future<TilePixels>> mPending;
+    std::uint64_t mFrame;
 };
 
-#endif // TRACK_H
\ No newline at end of file
+#endif // TRACK_H
@@ -0,0 +1,102 @@
+#ifndef TRACKCENTERLINE_H
+#define TRACKCENTERLINE_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CollisionMask.h"
+#include "ThreadPool.h"
+
+/// @brief Vector description of the circuit, derived once from the collision mask
+///
+/// The drivable cells (road, checkpoints, finish line) are thinned down to a
+/// one-pixel skeleton (Zhang-Suen, on the thread pool), spurs are pruned and
+/// the remaining loop is walked from the finish line in the race direction.
+/// The walk is smoothed into the control points of a closed Catmull-Rom spline,
+/// which is resampled at a fixed arc-length spacing: position, tangent and
+/// curvature queries are then a lookup and a lerp. Control points are cached
+/// on disk next to the LOD cache, keyed by a fingerprint of the mask, together
+/// with the racing line found by RacingLineOptimizer when there is one.
+class TrackCenterline {
+public:
+    /// @brief Optimized line, as lateral offsets of the centerline at evenly spaced knots
+    struct RacingLine {
+        std::vector<float> knots;  ///< Offsets in world units, > 0 to the right
+        float cornerMargin = 0.f;  ///< Share of the car's turn rate used in corners (AIDrivers)
+        float lapTime = 0.f;       ///< Simulated lap time (s)
+    };
+
+    TrackCenterline();
+
+    /// @brief Read the cache, or build the centerline and write the cache
+    /// @param mask Classified collision mask
+    /// @param worldScale World units per mask pixel
+    /// @param startHeading Race direction at the finish line (world, any length)
+    /// @param cachePath Cache file
+    /// @param pool Workers running the thinning passes
+    /// @return True if a closed centerline was found
+    bool load(const CollisionMask& mask, float worldScale, sf::Vector2f startHeading,
+              const std::string& cachePath, ThreadPool& pool);
+
+    /// @brief Build from the mask, without the cache
+    /// @return True if a closed centerline was found
+    bool build(const CollisionMask& mask, float worldScale, sf::Vector2f startHeading, ThreadPool& pool);
+
+    bool isValid() const;
+    float getLength() const;                                ///< Lap length in world units
+    float getSampleSpacing() const;                         ///< Arc length between two samples
+    const std::vector<sf::Vector2f>& getSamples() const;    ///< Evenly spaced points, from the finish line
+    const std::vector<sf::Vector2f>& getTangents() const;   ///< Unit tangents of the samples
+    const std::vector<float>& getCurvatures() const;        ///< Signed curvature (1/world unit), > 0 turning right
+
+    /// @brief Point at an arc length (wrapped around the lap)
+    sf::Vector2f positionAt(float distance) const;
+    /// @brief Unit tangent at an arc length
+    sf::Vector2f tangentAt(float distance) const;
+    /// @brief Signed curvature at an arc length
+    float curvatureAt(float distance) const;
+
+    /// @brief Arc length of the centerline point closest to a position
+    /// @param position World position
+    /// @param hint Previous result (searches CENTERLINE_PROJECT_WINDOW samples around it), < 0 for a full search
+    /// @return Distance from the finish line along the centerline
+    float project(sf::Vector2f position, float hint = -1.f) const;
+
+    bool hasRacingLine() const;
+    RacingLine getRacingLine() const;
+    void setRacingLine(const RacingLine& line);
+
+    /// @brief Offset of every sample, interpolated between knots (periodic Catmull-Rom)
+    /// @param knots Offsets at evenly spaced knots, the first one on sample 0
+    /// @return One offset per sample
+    std::vector<float> expandKnots(const std::vector<float>& knots) const;
+
+    /// @brief Rewrite the cache (after setRacingLine), through a temporary file and a rename
+    /// @param cachePath Cache file given to load()
+    /// @return False if the file could not be written (previous cache left intact)
+    bool save(const std::string& cachePath) const;
+
+    /// @brief Cache file of a mask, under Config::CACHE_PATH
+    static std::string cachePathOf(const std::string& maskFilename);
+
+private:
+    bool loadCache(const std::string& cachePath, std::uint64_t key);
+    void fitSpline(float worldScale);  ///< Control points -> arc-length samples
+    float wrap(float distance) const;
+
+private:
+    std::vector<sf::Vector2f> mControlPoints;  ///< Mask pixels (what the cache stores)
+    std::vector<float> mRacingKnots;           ///< Mask pixels, empty without an optimized line
+    float mCornerMargin;
+    float mLapTime;
+    float mWorldScale;
+    std::uint64_t mKey;                        ///< Mask fingerprint the cache is written with
+    std::vector<sf::Vector2f> mSamples;
+    std::vector<sf::Vector2f> mTangents;
+    std::vector<float> mCurvatures;
+    float mLength;
+    float mSpacing;
+};
+
+#endif // TRACKCENTERLINE_H
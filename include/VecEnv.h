@@ -0,0 +1,91 @@
+#ifndef VECENV_H
+#define VECENV_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "Car.h"
+#include "CollisionMask.h"
+#include "Config.h"
+#include "ThreadPool.h"
+#include "TrackCenterline.h"
+
+/// @brief N independent headless car simulations on one track, for training driving agents
+///
+/// Gym-style vectorized environment: step() applies one CarControls per
+/// environment, advances every car by one physics tick (the same Car::update
+/// as the player) across the thread pool, then writes the observations,
+/// rewards and done flags into flat buffers allocated once by the constructor.
+/// An environment whose episode ends (lap finished, stalled or out of time)
+/// is reset on the spot: its observation is then the first one of the next
+/// episode, as in usual vectorized environments.
+///
+/// Observation of one environment (OBSERVATION_SIZE floats):
+/// wall distances along VECENV_RAYS rays spread over VECENV_RAY_FOV (0..1 of
+/// VECENV_RAY_RANGE, CollisionMask::raycastFan), forward speed (/ CAR_MAX_SPEED),
+/// sine and cosine of the heading relative to the centerline tangent, lap
+/// progress (0..1).
+class VecEnv {
+public:
+    static constexpr std::size_t OBSERVATION_SIZE = Config::VECENV_RAYS + 4;
+
+    /// @brief Constructor
+    /// @param count Number of environments
+    /// @param carRect Car sprite region (its size sets the collision bumpers)
+    /// @param pool Workers stepping the environments
+    VecEnv(std::size_t count, const sf::IntRect& carRect, ThreadPool& pool);
+
+    // Chaque Car référence mTexture : ni copie ni déplacement
+    VecEnv(const VecEnv&) = delete;
+    VecEnv& operator=(const VecEnv&) = delete;
+
+    /// @brief Bind a track and start a new episode in every environment
+    /// @param mask Collision mask, scaled to world units (must outlive the environment)
+    /// @param centerline Centerline of the same mask (progress and start positions)
+    /// @param bounds World rectangle of the track (HeadlessTrack::getBounds)
+    void reset(const CollisionMask& mask, const TrackCenterline& centerline, const sf::FloatRect& bounds);
+
+    /// @brief Advance every environment by one physics tick
+    /// @param actions One CarControls per environment
+    void step(const CarControls* actions);
+
+    std::size_t getCount() const;
+    const float* getObservations() const;   ///< getCount() x OBSERVATION_SIZE, row per environment
+    const float* getRewards() const;        ///< Reward of the last step, per environment
+    const std::uint8_t* getDones() const;   ///< 1 if the episode ended on the last step (environment reset since)
+    const Car& getCar(std::size_t index) const;
+
+    /// @brief Headless benchmark: random actions on the game track, reports steps per second
+    /// @return Process exit code
+    static int runBenchmark();
+
+private:
+    void resetEnv(std::size_t index);
+    void stepEnv(std::size_t index, const CarControls& action);
+    void observe(std::size_t index);
+
+private:
+    sf::Texture mTexture; ///< Empty: the cars are never drawn
+    sf::IntRect mCarRect;
+    ThreadPool& mPool;
+    const CollisionMask* mMask = nullptr;
+    const TrackCenterline* mCenterline = nullptr;
+    sf::FloatRect mBounds;
+    std::vector<Car> mCars;
+
+    // État des épisodes (un élément par environnement)
+    std::vector<float> mArc;               ///< Centerline arc length at the last step (projection hint)
+    std::vector<float> mDistance;          ///< Signed distance driven along the centerline this episode
+    std::vector<float> mBestDistance;      ///< Furthest distance reached (stall detection)
+    std::vector<std::uint32_t> mSteps;     ///< Ticks in the episode
+    std::vector<std::uint32_t> mStallSteps; ///< Ticks without a new best distance
+    std::vector<std::minstd_rand> mRandom; ///< Start positions, one generator per environment
+
+    // Sorties (contiguës, allouées à la construction)
+    std::vector<float> mObservations;
+    std::vector<float> mRewards;
+    std::vector<std::uint8_t> mDones;
+};
+
+#endif // VECENV_H
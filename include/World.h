@@ -8,15 +8,50 @@
 #include "CollisionMask.h"
 #include "CheckpointManager.h"
 #include "GhostManager.h"
+#include "ThreadPool.h"
+#include "SpriteBatch.h"
+#include "ParticleSystem.h"
+#include "SkidMarkLayer.h"
+#include "Minimap.h"
+#include "QualityGovernor.h"
+#include "DrivingHeatmap.h"
+#include "TrackCenterline.h"
+#include "AIDrivers.h"
+#include <memory>
 
 class World {
 public:
-    explicit World(sf::RenderWindow& window, AssetsManager& assetsManager);
+    // Choix HD/SD partagé par le jeu et les outils : HD seulement si le circuit ET le masque HD existent
+    static void selectResolution(AssetsManager& assets);
+    static std::string getMaskFilename(const AssetsManager& assets);
 
-    void update(sf::Time deltaTime, sf::View& camera);
-    void render(bool isPlaying, float alpha = 1.0f);
+    // Décodages lourds, sans World ni atlas : ils démarrent en premier dans le pipeline (workers)
+    static void decodeTrack(Track& track, const AssetsManager& assets);          // Circuit + pyramide LOD
+    static void decodeCollisionMask(CollisionMask& mask, const AssetsManager& assets, ThreadPool& threadPool);
+
+    // Construction légère, une fois circuit et masque décodés : le chargement se termine par les étapes ci-dessous
+    World(sf::RenderWindow& window, AssetsManager& assetsManager, TextureHandle spriteAtlas, ThreadPool& threadPool,
+          std::unique_ptr<Track> track, CollisionMask&& collisionMask);
+
+    // Étapes de chargement (pipeline de démarrage)
+    void loadCenterline();     // Squelette du masque (ou cache), sur un worker
+    void finishLoading();      // Thread principal : textures GPU, échelle, minimap
+    void spawnDrivers(std::size_t count); // Adversaires IA sur la grille (après la ligne centrale)
+    void buildHeatmap(const std::vector<std::string>& inputs); // Binning des tours, sur un worker
+    void uploadHeatmap();      // Thread principal : texture de la surcouche
+    void toggleHeatmap();
+
+    void update(sf::Time deltaTime, const CarControls& controls, sf::View& camera);
+    void render(sf::RenderTarget& target, bool isPlaying, float alpha = 1.0f);
+    const std::string& getTrackId() const; // Clé du classement : nom du circuit, quelle que soit la résolution
+    void renderMinimap(sf::RenderTarget& target, bool isPlaying, float alpha = 1.0f);
+
+    // Réglages du gouverneur de qualité (particules, fantôme, LOD du circuit)
+    void setQuality(const QualitySettings& settings);
 
     sf::FloatRect getTrackBounds() const;
+    const Track& getTrack() const;
+    const TrackCenterline& getCenterline() const;
     Player& getPlayer();
     Car& getCar();
     bool isLapComplete();
@@ -24,19 +59,36 @@ public:
     int getLapCount() const;
     GhostManager& getGhost();
     bool isOnStartLine() const;
+    TerrainType getCarTerrain() const;
 
     // NOUVEAU : Signal de départ réel
     void startRace();
 
+private:
+    float getWorldScale() const; // Unités monde par pixel du circuit (et du masque)
+
 private:
     sf::RenderWindow& mWindow;
     AssetsManager& mAssetsManager;
-    Track mTrack;
+    ThreadPool& mThreadPool;
+    std::unique_ptr<Track> mTrack;
     Player mPlayer;
     CollisionMask mCollisionMask;
+    TrackCenterline mCenterline;
     CheckpointManager mCheckpoints;
     GhostManager mGhost;
+    AIDrivers mDrivers;
+    SpriteBatch mBatch;
+    ParticleSystem mParticles;
+    ParticleEmitter mPlayerEmitter;
+    std::unique_ptr<SkidMarkLayer> mSkidMarks; // Créé une fois la taille du circuit connue
+    SkidTrail mPlayerTrail;
+    std::unique_ptr<Minimap> mMinimap;
+    bool mShowGhost = true;
+    std::unique_ptr<DrivingHeatmap> mHeatmap; // Seulement avec --heatmap
+    bool mShowHeatmap = false;
     sf::Vector2f mTrackSize;
+    std::string mTrackId;
     int mLapCount;
 };
 
@@ -1,7 +1,22 @@
+#include "DrivingHeatmap.h"
 #include "Engine.h"
+#include "LaunchOptions.h"
+#include "ParticleSystem.h"
+#include "RacingLineOptimizer.h"
+#include "TelemetryReader.h"
+#include "VecEnv.h"
 
-int main() {
-    Engine engine;
+int main(int argc, char* argv[]) {
+    LaunchOptions options = LaunchOptions::parse(argc, argv);
+
+    // Modes sans fenêtre
+    if (options.benchParticles) return ParticleSystem::runBenchmark();
+    if (options.benchVecEnv) return VecEnv::runBenchmark();
+    if (!options.telemetryDump.empty()) return TelemetryReader::dump(options.telemetryDump);
+    if (options.optimizeGenerations > 0) return RacingLineOptimizer::runTool(options.optimizeGenerations);
+    if (!options.heatmapOutput.empty()) return DrivingHeatmap::runTool(options.heatmapInputs, options.heatmapOutput);
+
+    Engine engine(options);
     engine.run();
     return 0;
-}
\ No newline at end of file
+}
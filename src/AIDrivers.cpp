@@ -0,0 +1,231 @@
+#include "AIDrivers.h"
+#include "Config.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr float DEG_TO_RAD = 3.14159265f / 180.f;
+
+    // Vitesse sous laquelle Car::processSteering réduit le taux de rotation
+    constexpr float FULL_TURN_SPEED = 20.f;
+
+    // Teintes des adversaires (le joueur garde la couleur d'origine)
+    const sf::Color DRIVER_COLORS[] = {
+        sf::Color(255, 120, 120), sf::Color(120, 170, 255), sf::Color(140, 255, 140),
+        sf::Color(255, 220, 110), sf::Color(220, 140, 255), sf::Color(120, 240, 240)
+    };
+}
+
+AIDrivers::AIDrivers(sf::Texture& texture, const sf::IntRect& carRect) : mTexture(texture), mCarRect(carRect) {}
+
+void AIDrivers::setRacingLine(const TrackCenterline& centerline, const std::vector<float>& offsets, float cornerMargin) {
+    mCenterline = &centerline;
+    const std::vector<sf::Vector2f>& samples = centerline.getSamples();
+    const std::vector<sf::Vector2f>& tangents = centerline.getTangents();
+    const std::size_t count = samples.size();
+    mSpacing = centerline.getSampleSpacing();
+
+    // 1. Points de la ligne : centre décalé le long de la normale (droite = (-t.y, t.x))
+    mLineX.resize(count);
+    mLineY.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        float offset = i < offsets.size() ? offsets[i] : 0.f;
+        mLineX[i] = samples[i].x - tangents[i].y * offset;
+        mLineY[i] = samples[i].y + tangents[i].x * offset;
+    }
+
+    // 2. Vitesse de passage : rayon du cercle circonscrit, limité par le taux de rotation de la voiture
+    std::size_t window = std::max<std::size_t>(1, static_cast<std::size_t>(Config::AI_CURVATURE_WINDOW / mSpacing));
+    float maxYawRate = Config::CAR_MAX_TURN_RATE * DEG_TO_RAD * cornerMargin;
+    mTargetSpeed.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::size_t before = (i + count - window % count) % count;
+        std::size_t after = (i + window) % count;
+        sf::Vector2f a(mLineX[before] - mLineX[i], mLineY[before] - mLineY[i]);
+        sf::Vector2f b(mLineX[after] - mLineX[i], mLineY[after] - mLineY[i]);
+        float denominator = a.length() * b.length() * (a - b).length();
+        float curvature = denominator > 0.f ? 2.f * std::abs(a.cross(b)) / denominator : 0.f;
+        mTargetSpeed[i] = curvature > 0.f ? std::min(Config::CAR_MAX_SPEED, maxYawRate / curvature) : Config::CAR_MAX_SPEED;
+    }
+
+    // 3. Freinage anticipé : v² <= v_suivant² + 2.a.d, deux tours pour boucler le circuit
+    for (int lap = 0; lap < 2; ++lap) {
+        for (std::size_t n = count; n-- > 0;) {
+            std::size_t next = (n + 1) % count;
+            float distance = std::hypot(mLineX[next] - mLineX[n], mLineY[next] - mLineY[n]);
+            float reachable = std::sqrt(mTargetSpeed[next] * mTargetSpeed[next] + 2.f * Config::AI_BRAKING * distance);
+            mTargetSpeed[n] = std::min(mTargetSpeed[n], reachable);
+        }
+    }
+}
+
+void AIDrivers::spawn(std::size_t count, float startDistance) {
+    mCars.clear();
+    mGridPositions.clear();
+    mGridRotations.clear();
+    if (!mCenterline || mLineX.empty()) return;
+    count = std::min(count, Config::AI_MAX_DRIVERS);
+
+    // Grille en quinconce derrière le joueur, deux voitures par rang
+    mCars.reserve(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        float distance = startDistance - Config::AI_GRID_SPACING * static_cast<float>(k / 2 + 1);
+        float side = k % 2 == 0 ? -1.f : 1.f;
+        sf::Vector2f tangent = mCenterline->tangentAt(distance);
+        sf::Vector2f position = mCenterline->positionAt(distance) + sf::Vector2f(-tangent.y, tangent.x) * (side * Config::AI_GRID_LATERAL);
+        mGridPositions.push_back(position);
+        mGridRotations.push_back(std::atan2(tangent.y, tangent.x) / DEG_TO_RAD);
+
+        mCars.emplace_back(mTexture, mCarRect);
+        mCars.back().setColor(DRIVER_COLORS[k % std::size(DRIVER_COLORS)]);
+    }
+
+    mPosX.resize(count);
+    mPosY.resize(count);
+    mHeadX.resize(count);
+    mHeadY.resize(count);
+    mSpeed.resize(count);
+    mSteer.resize(count);
+    mLineIndex.resize(count);
+    mControls.resize(count);
+
+    // Les premiers sur la grille sont les plus rapides : moins d'embouteillages
+    mSkill.resize(count);
+    for (std::size_t k = 0; k < count; ++k) {
+        mSkill[k] = 1.f - (1.f - Config::AI_SKILL_MIN) * static_cast<float>(k) / static_cast<float>(std::max<std::size_t>(1, count - 1));
+    }
+    reset();
+}
+
+void AIDrivers::reset() {
+    for (std::size_t k = 0; k < mCars.size(); ++k) place(k, mGridPositions[k], mGridRotations[k]);
+}
+
+void AIDrivers::place(std::size_t index, sf::Vector2f position, float rotation) {
+    Car& car = mCars[index];
+    car.setPosition(position);
+    car.setRotation(rotation);
+    car.resetVelocity();
+
+    // Recherche complète une seule fois, ensuite suivi local
+    float bestDistance = std::numeric_limits<float>::max();
+    for (std::size_t i = 0; i < mLineX.size(); ++i) {
+        float dx = mLineX[i] - position.x;
+        float dy = mLineY[i] - position.y;
+        if (dx * dx + dy * dy < bestDistance) {
+            bestDistance = dx * dx + dy * dy;
+            mLineIndex[index] = static_cast<std::uint32_t>(i);
+        }
+    }
+    mControls[index] = CarControls();
+}
+
+void AIDrivers::update(sf::Time deltaTime, const sf::FloatRect& bounds, const CollisionMask& mask) {
+    // 1. Rassemblement des états en tableaux contigus
+    for (std::size_t k = 0; k < mCars.size(); ++k) {
+        const Car& car = mCars[k];
+        sf::Vector2f position = car.getPosition();
+        float heading = car.getRotation() * DEG_TO_RAD;
+        mPosX[k] = position.x;
+        mPosY[k] = position.y;
+        mHeadX[k] = std::cos(heading);
+        mHeadY[k] = std::sin(heading);
+        mSpeed[k] = car.getSpeed();
+        mSteer[k] = car.getSteer();
+    }
+
+    // 2. Décision pour tous les pilotes d'un coup
+    computeControls(mask);
+
+    // 3. Même physique que le joueur
+    for (std::size_t k = 0; k < mCars.size(); ++k) {
+        mCars[k].update(deltaTime, mControls[k], bounds, mask);
+    }
+}
+
+void AIDrivers::resolveContacts(Car& player, const CollisionMask& mask) {
+    // Au plus AI_MAX_DRIVERS voitures : toutes les paires, rejet rapide sur la distance des centres
+    for (std::size_t a = 0; a < mCars.size(); ++a) {
+        mCars[a].collideWith(player, mask);
+        for (std::size_t b = a + 1; b < mCars.size(); ++b) mCars[a].collideWith(mCars[b], mask);
+    }
+}
+
+void AIDrivers::computeControls(const CollisionMask& mask) {
+    const std::size_t lineCount = mLineX.size();
+    const std::size_t drivers = mCars.size();
+    const float maxYawRate = Config::CAR_MAX_TURN_RATE * DEG_TO_RAD;
+    const float inverseSpacing = 1.f / mSpacing;
+
+    for (std::size_t k = 0; k < drivers; ++k) {
+        const float x = mPosX[k];
+        const float y = mPosY[k];
+        const float speed = mSpeed[k];
+
+        // Échantillon le plus proche : descente locale depuis celui du tick précédent
+        std::size_t index = mLineIndex[k];
+        auto distanceTo = [&](std::size_t i) {
+            float dx = mLineX[i] - x;
+            float dy = mLineY[i] - y;
+            return dx * dx + dy * dy;
+        };
+        float current = distanceTo(index);
+        for (std::size_t step = 0; step < Config::AI_TRACKING_STEPS; ++step) {
+            std::size_t next = index + 1 == lineCount ? 0 : index + 1;
+            std::size_t previous = index == 0 ? lineCount - 1 : index - 1;
+            float toNext = distanceTo(next);
+            float toPrevious = distanceTo(previous);
+            if (toNext < current && toNext <= toPrevious) { index = next; current = toNext; }
+            else if (toPrevious < current) { index = previous; current = toPrevious; }
+            else break;
+        }
+        mLineIndex[k] = static_cast<std::uint32_t>(index);
+
+        // Poursuite pure : point visé à une distance qui croît avec la vitesse
+        float lookAhead = Config::AI_LOOKAHEAD_MIN + Config::AI_LOOKAHEAD_TIME * speed;
+        std::size_t offset = static_cast<std::size_t>(lookAhead * inverseSpacing);
+        std::size_t target = (index + offset) % lineCount;
+        float dx = mLineX[target] - x;
+        float dy = mLineY[target] - y;
+
+        // Point visé caché par un mur (épingle) : visée raccourcie pour ne pas couper à travers
+        for (std::size_t retry = 0; retry < Config::AI_SIGHT_RETRIES && offset > 1; ++retry) {
+            float distance = std::sqrt(dx * dx + dy * dy);
+            if (mask.raycast({x, y}, {dx, dy}, distance) >= distance) break;
+            offset /= 2;
+            target = (index + offset) % lineCount;
+            dx = mLineX[target] - x;
+            dy = mLineY[target] - y;
+        }
+        float ahead = dx * mHeadX[k] + dy * mHeadY[k];
+        float lateral = dy * mHeadX[k] - dx * mHeadY[k]; // > 0 : cible à droite
+        float pursuitCurvature = 2.f * lateral / std::max(dx * dx + dy * dy, 1e-3f);
+
+        // Braquage voulu : courbure visée / courbure max à cette vitesse
+        float maxCurvature = speed < FULL_TURN_SPEED ? maxYawRate / FULL_TURN_SPEED : maxYawRate / speed;
+        float wantedSteer = ahead > 0.f ? std::clamp(pursuitCurvature / maxCurvature, -1.f, 1.f)
+                                        : (lateral >= 0.f ? 1.f : -1.f); // Cible derrière : braquage max
+
+        // Commandes tout-ou-rien : le braquage lissé de la voiture suit la consigne
+        CarControls& controls = mControls[k];
+        controls.turnRight = wantedSteer > mSteer[k] + Config::AI_STEER_DEADBAND;
+        controls.turnLeft = wantedSteer < mSteer[k] - Config::AI_STEER_DEADBAND;
+
+        // Vitesse : profil lu un peu en avant (temps de réaction), modulé par le niveau du pilote
+        std::size_t preview = (index + static_cast<std::size_t>(speed * Config::AI_REACTION_TIME * inverseSpacing)) % lineCount;
+        float targetSpeed = mTargetSpeed[preview] * mSkill[k];
+        controls.accelerate = speed < targetSpeed;
+        controls.brake = speed > targetSpeed + Config::AI_BRAKE_MARGIN;
+    }
+}
+
+void AIDrivers::render(SpriteBatch& batch, float alpha) const {
+    for (const Car& car : mCars) car.render(batch, alpha);
+}
+
+std::size_t AIDrivers::getCount() const { return mCars.size(); }
+const Car& AIDrivers::getCar(std::size_t index) const { return mCars[index]; }
+const std::vector<CarControls>& AIDrivers::getControls() const { return mControls; }
+std::uint32_t AIDrivers::getLineIndex(std::size_t index) const { return mLineIndex[index]; }
+std::size_t AIDrivers::getLineSize() const { return mLineX.size(); }
@@ -0,0 +1,85 @@
+#include "AssetArchive.h"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+namespace {
+    // Finaliseur de splitmix64 : chaque bit d'entrée influence tous les bits de sortie
+    std::uint64_t mix(std::uint64_t value) {
+        value ^= value >> 30;
+        value *= 0xBF58476D1CE4E5B9ull;
+        value ^= value >> 27;
+        value *= 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+}
+
+std::uint64_t fileFingerprint(const std::string& path) {
+    std::error_code ec;
+    std::uint64_t size = std::filesystem::file_size(path, ec);
+    if (ec) return 0;
+    auto time = std::filesystem::last_write_time(path, ec).time_since_epoch().count();
+    return mix(mix(size) + static_cast<std::uint64_t>(time));
+}
+
+AssetArchive::~AssetArchive() {
+    close();
+}
+
+bool AssetArchive::open(const std::string& path) {
+    close();
+    if (!mFile.open(path)) return false;
+    const std::uint8_t* data = mFile.data();
+    std::size_t size = mFile.size();
+
+    // Validation de l'en-tête et de chaque entrée avant toute lecture
+    PackFormat::Header header;
+    if (size < sizeof(header)) { close(); return false; }
+    std::memcpy(&header, data, sizeof(header));
+    std::size_t indexEnd = sizeof(header) + static_cast<std::size_t>(header.entryCount) * sizeof(PackFormat::Entry);
+    if (std::memcmp(header.magic, PackFormat::MAGIC, sizeof(header.magic)) != 0 || indexEnd > size) {
+        std::cout << "Asset archive " << path << " is invalid, using loose files" << std::endl;
+        close();
+        return false;
+    }
+
+    for (std::uint32_t i = 0; i < header.entryCount; ++i) {
+        PackFormat::Entry entry;
+        std::memcpy(&entry, data + sizeof(header) + i * sizeof(entry), sizeof(entry));
+        entry.name[PackFormat::NAME_SIZE - 1] = '\0';
+        if (entry.offset > size || entry.size > size - entry.offset) continue;
+
+        PackedAsset asset;
+        asset.data = data + entry.offset;
+        asset.size = static_cast<std::size_t>(entry.size);
+        asset.width = entry.width;
+        asset.height = entry.height;
+        asset.format = entry.format;
+        if (asset.format == PackFormat::Format::Rgba8 && std::uint64_t(asset.width) * asset.height * 4 != entry.size) continue;
+        mEntries.emplace(entry.name, asset);
+    }
+
+    mSourceKey = fileFingerprint(path);
+
+    std::cout << "Asset archive " << path << ": " << mEntries.size() << " entries, "
+              << size / (1024 * 1024) << " MB mapped" << std::endl;
+    return true;
+}
+
+bool AssetArchive::isOpen() const {
+    return mFile.isOpen();
+}
+
+const PackedAsset* AssetArchive::find(const std::string& name) const {
+    auto it = mEntries.find(name);
+    return it != mEntries.end() ? &it->second : nullptr;
+}
+
+std::uint64_t AssetArchive::getSourceKey() const {
+    return mSourceKey;
+}
+
+void AssetArchive::close() {
+    mEntries.clear();
+    mFile.close();
+}
@@ -1,40 +1,150 @@
 #include "AssetsManager.h"
+#include "Config.h"
+#include <filesystem>
+#include <iostream>
 #include <stdexcept>
 
-AssetsManager::AssetsManager() {}
+AssetsManager::AssetsManager() : mAtlas(Config::ATLAS_MAX_SIZE) {}
 
-bool AssetsManager::loadTexture(const std::string& name, const std::string& filepath) {
-    sf::Texture texture;
-    if (!texture.loadFromFile(filepath)) { // https://www.sfml-dev.org/documentation/3.0.0/classsf_1_1Texture.php#a75c2f3d8e4c1d3f4bbd7cd8f7e4d554e
-        return false;
+bool AssetsManager::openArchive(const std::string& path) {
+    return mArchive.open(path);
+}
+
+const PackedAsset* AssetsManager::findPacked(const std::string& filepath) const {
+    if (!mArchive.isOpen()) return nullptr;
+
+    // Les entrées sont nommées relativement au dossier assets/
+    const std::string& root = Config::ASSETS_PATH;
+    if (filepath.compare(0, root.size(), root) != 0) return nullptr;
+    return mArchive.find(filepath.substr(root.size()));
+}
+
+bool AssetsManager::hasAsset(const std::string& filepath) const {
+    return findPacked(filepath) || std::filesystem::exists(filepath);
+}
+
+std::uint64_t AssetsManager::getArchiveKey() const {
+    return mArchive.isOpen() ? mArchive.getSourceKey() : 0;
+}
+
+bool AssetsManager::loadImage(const std::string& filepath, sf::Image& image) const {
+    const PackedAsset* packed = findPacked(filepath);
+    if (!packed) return image.loadFromFile(filepath);
+    if (packed->format == PackFormat::Format::Raw) return image.loadFromMemory(packed->data, packed->size);
+    image.resize({packed->width, packed->height}, packed->data);
+    return true;
+}
+
+bool AssetsManager::uploadPacked(sf::Texture& texture, const PackedAsset& asset) {
+    if (asset.format == PackFormat::Format::Raw) {
+        return texture.loadFromMemory(asset.data, asset.size);
     }
-    mTextures[name] = texture;
+    // RGBA déjà décodé : envoi direct depuis le mapping, sans sf::Image intermédiaire
+    if (!texture.resize({asset.width, asset.height})) return false;
+    texture.update(asset.data);
     return true;
 }
 
-sf::Texture& AssetsManager::getTexture(const std::string& name) {
-    for (auto& pair : mTextures) {
-        if (pair.first == name)
-            return pair.second;
+TextureHandle AssetsManager::allocateTexture(const std::string& name, const std::string& filepath) {
+    // Un nom déjà chargé réutilise son emplacement
+    auto it = mTextureNames.find(name);
+    std::uint32_t index = it != mTextureNames.end() ? it->second : static_cast<std::uint32_t>(mTextures.size());
+    if (it == mTextureNames.end()) {
+        mTextures.emplace_back();
+        mTextureNames.emplace(name, index);
     }
+    mTextures[index].filepath = filepath;
+    mTextures[index].state = LoadState::Pending;
+    return TextureHandle{index};
+}
+
+TextureHandle AssetsManager::loadTexture(const std::string& name, const std::string& filepath) {
+    TextureHandle handle = allocateTexture(name, filepath);
+    TextureSlot& slot = mTextures[handle.index];
 
-    throw std::runtime_error("Texture not found: " + name);
+    // Chargement en place : plus de copie de la texture dans le conteneur
+    const PackedAsset* packed = findPacked(filepath);
+    bool ok = packed ? uploadPacked(slot.texture, *packed) : slot.texture.loadFromFile(filepath); // https://www.sfml-dev.org/documentation/3.0.0/classsf_1_1Texture.php#a75c2f3d8e4c1d3f4bbd7cd8f7e4d554e
+    if (!ok) {
+        slot.state = LoadState::Failed;
+        return TextureHandle{};
+    }
+    slot.state = LoadState::Ready;
+    return handle;
 }
 
-bool AssetsManager::loadFont(const std::string& name, const std::string& filepath) {
-    sf::Font font;
-    if (!font.openFromFile(filepath)) { // https://www.sfml-dev.org/documentation/3.0.0/classsf_1_1Font.php#a3dfc31f9c1746a7ce03f45f1b2a4b7bf
+sf::Texture& AssetsManager::getTexture(TextureHandle handle) {
+    if (!handle.isValid() || handle.index >= mTextures.size()) {
+        throw std::runtime_error("Invalid texture handle");
+    }
+    return mTextures[handle.index].texture;
+}
+
+bool AssetsManager::addAtlasImage(const std::string& name, const std::string& filepath) {
+    // Archive : pixels RGBA lus dans le mapping, sans décodage
+    const PackedAsset* packed = findPacked(filepath);
+    if (packed && packed->format == PackFormat::Format::Rgba8) {
+        std::lock_guard<std::mutex> lock(mAtlasMutex);
+        mAtlas.add(name, packed->data, {packed->width, packed->height});
+        return true;
+    }
+
+    sf::Image image;
+    if (!loadImage(filepath, image)) {
+        std::cerr << "Failed to load atlas image " << filepath << std::endl;
         return false;
     }
-    mFonts[name] = font;
+    addAtlasImage(name, image);
     return true;
 }
 
-sf::Font& AssetsManager::getFont(const std::string& name) {
-    for (auto& pair : mFonts) {
-        if (pair.first == name)
-            return pair.second;
+void AssetsManager::addAtlasImage(const std::string& name, const sf::Image& image) {
+    std::lock_guard<std::mutex> lock(mAtlasMutex);
+    mAtlas.add(name, image.getPixelsPtr(), image.getSize());
+}
+
+TextureHandle AssetsManager::buildAtlas(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mAtlasMutex);
+    if (!mAtlas.pack()) return TextureHandle{};
+
+    TextureHandle handle = allocateTexture(name, "");
+    TextureSlot& slot = mTextures[handle.index];
+    if (!mAtlas.upload(slot.texture)) {
+        slot.state = LoadState::Failed;
+        return TextureHandle{};
+    }
+    slot.state = LoadState::Ready;
+    return handle;
+}
+
+sf::IntRect AssetsManager::getAtlasRegion(const std::string& name) const {
+    const sf::IntRect* region = mAtlas.find(name);
+    if (!region) {
+        throw std::runtime_error("Unknown atlas region " + name);
+    }
+    return *region;
+}
+
+FontHandle AssetsManager::loadFont(const std::string& name, const std::string& filepath) {
+    auto it = mFontNames.find(name);
+    std::uint32_t index = it != mFontNames.end() ? it->second : static_cast<std::uint32_t>(mFonts.size());
+    if (it == mFontNames.end()) mFonts.emplace_back();
+
+    // Police de l'archive : SFML lit directement dans le mapping (qui survit aux polices)
+    const PackedAsset* packed = findPacked(filepath);
+    bool ok = packed ? mFonts[index].openFromMemory(packed->data, packed->size) : mFonts[index].openFromFile(filepath); // https://www.sfml-dev.org/documentation/3.0.0/classsf_1_1Font.php#a3dfc31f9c1746a7ce03f45f1b2a4b7bf
+    if (!ok) {
+        // Nouveau nom en échec : pas d'emplacement orphelin
+        if (it == mFontNames.end()) mFonts.pop_back();
+        return FontHandle{};
     }
+    mFontNames.emplace(name, index);
+    return FontHandle{index};
+}
 
-    throw std::runtime_error("Font not found: " + name);
+sf::Font& AssetsManager::getFont(FontHandle handle) {
+    if (!handle.isValid() || handle.index >= mFonts.size()) {
+        throw std::runtime_error("Invalid font handle");
+    }
+    return mFonts[handle.index];
 }
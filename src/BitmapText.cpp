@@ -0,0 +1,145 @@
+#include "BitmapText.h"
+#include "Profiler.h"
+#include <algorithm>
+
+BitmapText::BitmapText(const GlyphAtlas& atlas) : mAtlas(atlas) {}
+
+std::size_t BitmapText::addField(std::size_t capacity, float characterSize, sf::Color color, bool outlined, Align align) {
+    Field field;
+    field.firstVertex = mVertices.size();
+    field.firstChar = mChars.size();
+    field.capacity = capacity;
+    field.scale = characterSize / static_cast<float>(mAtlas.getCharacterSize());
+    field.color = color;
+    field.outlined = outlined;
+    field.align = align;
+
+    // Contours de tous les caractères, puis remplissages : le contour d'une
+    // lettre ne recouvre jamais sa voisine
+    mVertices.resize(mVertices.size() + capacity * 12);
+    mChars.resize(mChars.size() + capacity, '\0');
+    mPens.resize(mPens.size() + capacity);
+    mFields.push_back(field);
+    return mFields.size() - 1;
+}
+
+std::size_t BitmapText::addQuads(std::size_t count) {
+    std::size_t first = mVertices.size() / 6;
+    mVertices.resize(mVertices.size() + count * 6);
+    for (std::size_t i = first; i < first + count; ++i) {
+        for (std::size_t v = 0; v < 6; ++v) mVertices[i * 6 + v].texCoords = mAtlas.getWhiteTexel();
+    }
+    return first;
+}
+
+void BitmapText::setPosition(std::size_t field, sf::Vector2f position) {
+    Field& f = mFields[field];
+    if (f.position == position) return;
+    f.position = position;
+    f.moved = true;
+
+    // Relayout immédiat du texte courant (terminé par '\0' ou par la capacité)
+    if (f.length > 0) setText(field, &mChars[f.firstChar]);
+}
+
+float BitmapText::lineWidth(const Field& field, const char* text, std::size_t length) const {
+    float width = 0.f;
+    for (std::size_t i = 0; i < length && text[i] != '\n'; ++i) width += mAtlas.getFill(text[i]).advance;
+    return width * field.scale;
+}
+
+void BitmapText::setText(std::size_t field, const char* text) {
+    Field& f = mFields[field];
+    std::size_t length = 0;
+    while (length < f.capacity && text[length] != '\0') ++length;
+
+    float alignFactor = f.align == Align::Left ? 0.f : (f.align == Align::Center ? 0.5f : 1.f);
+    float lineHeight = mAtlas.getLineSpacing() * f.scale;
+    float baseline = f.position.y + mAtlas.getCharacterSize() * f.scale;
+
+    sf::Vector2f pen(f.position.x - alignFactor * lineWidth(f, text, length), baseline);
+    sf::Vertex* outlines = &mVertices[f.firstVertex];
+    sf::Vertex* fills = outlines + f.capacity * 6;
+
+    for (std::size_t i = 0; i < std::max(length, f.length); ++i) {
+        char& written = mChars[f.firstChar + i];
+        sf::Vector2f& writtenPen = mPens[f.firstChar + i];
+
+        if (i >= length) {
+            // Emplacement libéré : quads dégénérés
+            clearQuad(outlines + i * 6);
+            clearQuad(fills + i * 6);
+            written = '\0';
+            continue;
+        }
+
+        char c = text[i];
+        if (c != written || pen != writtenPen || f.moved) {
+            if (c == '\n') {
+                clearQuad(outlines + i * 6);
+                clearQuad(fills + i * 6);
+            } else {
+                if (f.outlined) writeGlyph(outlines + i * 6, mAtlas.getOutline(c), pen, f.scale, sf::Color::Black);
+                writeGlyph(fills + i * 6, mAtlas.getFill(c), pen, f.scale, f.color);
+            }
+            written = c;
+            writtenPen = pen;
+        }
+
+        if (c == '\n') {
+            pen.x = f.position.x - alignFactor * lineWidth(f, text + i + 1, length - i - 1);
+            pen.y += lineHeight;
+        } else {
+            pen.x += mAtlas.getFill(c).advance * f.scale;
+        }
+    }
+
+    f.length = length;
+    f.moved = false;
+}
+
+void BitmapText::shiftTexCoords(sf::Vector2f delta) {
+    for (sf::Vertex& vertex : mVertices) vertex.texCoords += delta;
+}
+
+void BitmapText::setQuad(std::size_t quad, sf::Vector2f position, sf::Vector2f size, sf::Color color) {
+    sf::Vertex* v = &mVertices[quad * 6];
+    sf::Vector2f topRight = {position.x + size.x, position.y};
+    sf::Vector2f bottomLeft = {position.x, position.y + size.y};
+    sf::Vector2f bottomRight = position + size;
+
+    v[0].position = position;   v[1].position = topRight;    v[2].position = bottomLeft;
+    v[3].position = bottomLeft; v[4].position = topRight;    v[5].position = bottomRight;
+    for (int i = 0; i < 6; ++i) v[i].color = color;
+}
+
+void BitmapText::writeGlyph(sf::Vertex* quad, const GlyphAtlas::Glyph& glyph, sf::Vector2f pen, float scale, sf::Color color) {
+    sf::Vector2f p0 = pen + glyph.bounds.position * scale;
+    sf::Vector2f p1 = p0 + glyph.bounds.size * scale;
+    sf::Vector2f t0 = glyph.texRect.position;
+    sf::Vector2f t1 = t0 + glyph.texRect.size;
+
+    quad[0] = {{p0.x, p0.y}, color, {t0.x, t0.y}};
+    quad[1] = {{p1.x, p0.y}, color, {t1.x, t0.y}};
+    quad[2] = {{p0.x, p1.y}, color, {t0.x, t1.y}};
+    quad[3] = {{p0.x, p1.y}, color, {t0.x, t1.y}};
+    quad[4] = {{p1.x, p0.y}, color, {t1.x, t0.y}};
+    quad[5] = {{p1.x, p1.y}, color, {t1.x, t1.y}};
+}
+
+void BitmapText::clearQuad(sf::Vertex* quad) {
+    for (int i = 0; i < 6; ++i) quad[i].position = quad[0].position;
+}
+
+std::size_t BitmapText::getVertexCount() const {
+    return mVertices.size();
+}
+
+void BitmapText::draw(sf::RenderTarget& target, std::size_t vertexCount) const {
+    vertexCount = std::min(vertexCount, mVertices.size());
+    if (vertexCount == 0) return;
+
+    sf::RenderStates states(&mAtlas.getTexture());
+    target.draw(mVertices.data(), vertexCount, sf::PrimitiveType::Triangles, states);
+    Profiler::countDrawCall(vertexCount);
+}
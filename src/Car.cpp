@@ -3,15 +3,15 @@
 #include <cmath>
 #include <algorithm>
 
-Car::Car(sf::Texture& texture)
-    : mSprite(texture), mVelocity(0.f, 0.f), mCurrentSteer(0.f), mGrassIntensity(0.f)
+Car::Car(sf::Texture& texture, const sf::IntRect& textureRect)
+    : mSprite(texture, textureRect), mVelocity(0.f, 0.f), mCurrentSteer(0.f), mGrassIntensity(0.f)
 {
     mSprite.setPosition({Config::CAR_INITIAL_POS_X, Config::CAR_INITIAL_POS_Y});
     mSprite.setRotation(sf::degrees(Config::CAR_INITIAL_ROTATION));
     mSprite.setScale({Config::CAR_SCALE, Config::CAR_SCALE});
 
-    sf::Vector2u textureSize = texture.getSize();
-    mSprite.setOrigin({textureSize.x / 2.f, textureSize.y / 2.f});
+    sf::Vector2f size(textureRect.size);
+    mSprite.setOrigin({size.x / 2.f, size.y / 2.f});
 
     mPreviousPosition = mSprite.getPosition();
     mPreviousRotation = mSprite.getRotation().asDegrees();
@@ -190,6 +190,9 @@ void Car::applyDrift(const sf::Vector2f& forward, float currentSpeed) {
     sf::Vector2f lateralVelocity = mVelocity - forwardVelocity;
     float gripFactor = 0.05f;
 
+    // Glissement latéral (avant adhérence) : pilote la fumée des pneus
+    mLateralSlip = std::sqrt(lateralVelocity.x * lateralVelocity.x + lateralVelocity.y * lateralVelocity.y);
+
     mVelocity = forwardVelocity + lateralVelocity * gripFactor;
 }
 
@@ -236,24 +239,70 @@ void Car::resolveCollisions(float dt, const sf::Vector2f& forward, const Collisi
     }
 }
 
+bool Car::collideWith(Car& other, const CollisionMask& mask) {
+    // Chaque voiture = deux cercles de la largeur de la voiture, à l'avant et à l'arrière
+    sf::Vector2f halfA = getHalfSize();
+    sf::Vector2f halfB = other.getHalfSize();
+    sf::Vector2f delta = other.getPosition() - getPosition();
+    float reach = halfA.x + halfB.x;
+    if (delta.x * delta.x + delta.y * delta.y >= reach * reach) return false;
+
+    float angleA = mSprite.getRotation().asRadians();
+    float angleB = other.mSprite.getRotation().asRadians();
+    sf::Vector2f axisA = sf::Vector2f(std::cos(angleA), std::sin(angleA)) * std::max(0.f, halfA.x - halfA.y);
+    sf::Vector2f axisB = sf::Vector2f(std::cos(angleB), std::sin(angleB)) * std::max(0.f, halfB.x - halfB.y);
+    float radius = halfA.y + halfB.y;
+
+    // Paire de cercles la plus enfoncée
+    float depth = 0.f;
+    sf::Vector2f normal;
+    for (float sa : {-1.f, 1.f}) {
+        for (float sb : {-1.f, 1.f}) {
+            sf::Vector2f d = (other.getPosition() + axisB * sb) - (getPosition() + axisA * sa);
+            float distance = d.length();
+            if (distance >= radius || radius - distance <= depth) continue;
+            depth = radius - distance;
+            normal = distance > 0.0001f ? d / distance : sf::Vector2f(1.f, 0.f);
+        }
+    }
+    if (depth <= 0.f) return false;
+
+    // Séparation partagée, annulée pour celle qui finirait dans un mur
+    sf::Vector2f push = normal * (depth * 0.5f);
+    if (mask.isTraversable(getPosition() - push)) mSprite.setPosition(getPosition() - push);
+    if (mask.isTraversable(other.getPosition() + push)) other.mSprite.setPosition(other.getPosition() + push);
+
+    // Masses égales : échange de la vitesse de rapprochement, amortie
+    float closing = (mVelocity - other.mVelocity).dot(normal);
+    if (closing > 0.f) {
+        sf::Vector2f impulse = normal * (closing * (1.f + Config::CAR_CONTACT_RESTITUTION) * 0.5f);
+        mVelocity -= impulse;
+        other.mVelocity += impulse;
+    }
+    return true;
+}
+
 // -----------------------------------------------------------------------
 // Méthodes utilitaires et accesseurs existants
 // -----------------------------------------------------------------------
 
-void Car::render(sf::RenderWindow& window, float alpha) {
-    sf::Vector2f currentPos = mSprite.getPosition();
-    sf::Vector2f interpPos = mPreviousPosition * (1.f - alpha) + currentPos * alpha;
-
-    float currentRot = mSprite.getRotation().asDegrees();
-    float interpRot = lerpAngle(mPreviousRotation, currentRot, alpha);
-
-    mSprite.setPosition(interpPos);
-    mSprite.setRotation(sf::degrees(interpRot));
-
-    window.draw(mSprite);
+void Car::render(SpriteBatch& batch, float alpha) const {
+    // Le sprite n'est plus déplacé/restauré : on calcule directement la transformation interpolée
+    batch.draw(mSprite.getTexture(), mSprite.getTextureRect(), getInterpolatedTransform(alpha),
+               mSprite.getColor(), SpriteBatch::LayerCars);
+}
 
-    mSprite.setPosition(currentPos);
-    mSprite.setRotation(sf::degrees(currentRot));
+sf::Transform Car::getInterpolatedTransform(float alpha) const {
+    sf::Vector2f interpPos = getInterpolatedPosition(alpha);
+    float interpRot = lerpAngle(mPreviousRotation, mSprite.getRotation().asDegrees(), alpha);
+
+    // Même composition que sf::Transformable : translation * rotation * échelle * -origine
+    sf::Transform transform;
+    transform.translate(interpPos);
+    transform.rotate(sf::degrees(interpRot));
+    transform.scale(mSprite.getScale());
+    transform.translate(-mSprite.getOrigin());
+    return transform;
 }
 
 float Car::lerpAngle(float start, float end, float t) {
@@ -267,7 +316,24 @@ sf::Vector2f Car::getPosition() const { return mSprite.getPosition(); }
 sf::Vector2f Car::getInterpolatedPosition(float alpha) const { return mPreviousPosition * (1.f - alpha) + mSprite.getPosition() * alpha; }
 void Car::setPosition(const sf::Vector2f& pos) { mSprite.setPosition(pos); mPreviousPosition = pos; }
 const sf::Sprite& Car::getSprite() const { return mSprite; }
-void Car::resetVelocity() { mVelocity = {0.f, 0.f}; }
+void Car::resetVelocity() { mVelocity = {0.f, 0.f}; mLateralSlip = 0.f; mGrassIntensity = 0.f; }
 void Car::setRotation(float angle) { mSprite.setRotation(sf::degrees(angle)); mPreviousRotation = angle; }
+void Car::setColor(sf::Color color) { mSprite.setColor(color); }
 float Car::getRotation() const { return mSprite.getRotation().asDegrees(); }
-float Car::getSpeed() const { return std::sqrt(mVelocity.x * mVelocity.x + mVelocity.y * mVelocity.y); }
\ No newline at end of file
+float Car::getSpeed() const { return std::sqrt(mVelocity.x * mVelocity.x + mVelocity.y * mVelocity.y); }
+sf::Vector2f Car::getVelocity() const { return mVelocity; }
+sf::Vector2f Car::getHalfSize() const {
+    sf::Vector2f size(mSprite.getTextureRect().size);
+    return {size.x * mSprite.getScale().x / 2.f, size.y * mSprite.getScale().y / 2.f};
+}
+std::array<sf::Vector2f, 2> Car::getRearWheelPositions() const {
+    float angle = getRotation() * 3.14159265f / 180.f;
+    sf::Vector2f forward(std::cos(angle), std::sin(angle));
+    sf::Vector2f right(-forward.y, forward.x);
+    sf::Vector2f halfSize = getHalfSize();
+    sf::Vector2f rear = getPosition() - forward * (halfSize.x * 0.8f);
+    return {rear + right * (halfSize.y * 0.7f), rear - right * (halfSize.y * 0.7f)};
+}
+float Car::getLateralSlip() const { return mLateralSlip; }
+float Car::getGrassIntensity() const { return mGrassIntensity; }
+float Car::getSteer() const { return mCurrentSteer; }
\ No newline at end of file
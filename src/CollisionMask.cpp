@@ -1,45 +1,59 @@
 #include "CollisionMask.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 CollisionMask::CollisionMask() : mScale(1.0f) {}
 
-bool CollisionMask::loadFromFile(const std::string& path) {
-    if (!mImage.loadFromFile(path)) return false;
+bool CollisionMask::loadFromFile(const std::string& path, ThreadPool* pool) {
+    // L'image n'est plus gardée : seule la grille sert après la classification
+    sf::Image image;
+    if (!image.loadFromFile(path)) return false;
+    return loadFromPixels(image.getPixelsPtr(), image.getSize(), pool);
+}
 
-    mSize = mImage.getSize();
-    const std::uint8_t* pixels = mImage.getPixelsPtr();
+bool CollisionMask::loadFromPixels(const std::uint8_t* pixels, sf::Vector2u size, ThreadPool* pool) {
+    if (!pixels || size.x == 0 || size.y == 0) return false;
+    mSize = size;
 
     // Initialisation de la grille
     mGrid.resize(mSize.x * mSize.y);
 
-    // Pré-calcul complet de la carte
-    for (unsigned int y = 0; y < mSize.y; ++y) {
-        for (unsigned int x = 0; x < mSize.x; ++x) {
-            unsigned int i = (x + y * mSize.x) * 4;
-            std::uint8_t r = pixels[i];
-            std::uint8_t g = pixels[i + 1];
-            std::uint8_t b = pixels[i + 2];
-            // a = pixels[i+3] (non utilisé)
-
-            TerrainType type = TerrainType::ROAD; // Par défaut
-
-            // Logique de détection (ordre de priorité)
-            if (r == 0 && g == 0 && b == 0) {
-                type = TerrainType::WALL;
-            }
-            else if (r == 255 && g == 255 && b == 0) { // Jaune
-                type = TerrainType::GRASS;
+    // Pré-calcul complet de la carte, par bandes de lignes indépendantes
+    auto classifyRows = [&](std::size_t begin, std::size_t end) {
+        for (unsigned int y = static_cast<unsigned int>(begin); y < end; ++y) {
+            for (unsigned int x = 0; x < mSize.x; ++x) {
+                unsigned int i = (x + y * mSize.x) * 4;
+                std::uint8_t r = pixels[i];
+                std::uint8_t g = pixels[i + 1];
+                std::uint8_t b = pixels[i + 2];
+                // a = pixels[i+3] (non utilisé)
+
+                TerrainType type = TerrainType::ROAD; // Par défaut
+
+                // Logique de détection (ordre de priorité)
+                if (r == 0 && g == 0 && b == 0) {
+                    type = TerrainType::WALL;
+                }
+                else if (r == 255 && g == 255 && b == 0) { // Jaune
+                    type = TerrainType::GRASS;
+                }
+                else if (r == 0 && g == 255 && b == 0) {   // Vert
+                    type = TerrainType::CHECKPOINT;
+                }
+                else if (r == 0 && g == 0 && b == 255) {   // Bleu
+                    type = TerrainType::FINISH_LINE;
+                }
+
+                // Stockage linéaire
+                mGrid[x + y * mSize.x] = type;
             }
-            else if (r == 0 && g == 255 && b == 0) {   // Vert
-                type = TerrainType::CHECKPOINT;
-            }
-            else if (r == 0 && g == 0 && b == 255) {   // Bleu
-                type = TerrainType::FINISH_LINE;
-            }
-
-            // Stockage linéaire
-            mGrid[x + y * mSize.x] = type;
         }
-    }
+    };
+
+    if (pool) pool->parallelFor(mSize.y, classifyRows);
+    else classifyRows(0, mSize.y);
 
     return true;
 }
@@ -58,8 +72,12 @@ sf::Vector2u CollisionMask::worldToImage(sf::Vector2f pos) const {
     );
 }
 
+const std::vector<TerrainType>& CollisionMask::getGrid() const { return mGrid; }
+sf::Vector2u CollisionMask::getSize() const { return mSize; }
+
 // Méthode helper interne sécurisée
 TerrainType CollisionMask::getTerrainAt(unsigned int x, unsigned int y) const {
+    Profiler::countTerrainQuery();
     if (x >= mSize.x || y >= mSize.y) return TerrainType::GRASS; // Hors map = Herbe (ou Mur selon choix)
     return mGrid[x + y * mSize.x];
 }
@@ -87,4 +105,94 @@ bool CollisionMask::isTraversable(sf::Vector2f worldPos) const {
     TerrainType t = getTerrainAt(p.x, p.y);
     // Traversable si ce n'est pas un MUR
     return t != TerrainType::WALL;
-}
\ No newline at end of file
+}
+
+TerrainType CollisionMask::getTerrain(sf::Vector2f worldPos) const {
+    sf::Vector2u p = worldToImage(worldPos);
+    return getTerrainAt(p.x, p.y);
+}
+
+// --- LANCER DE RAYONS ---
+
+float CollisionMask::raycast(sf::Vector2f origin, sf::Vector2f direction, float maxDistance) const {
+    float length = direction.length();
+    if (length <= 0.f || maxDistance <= 0.f) return std::max(maxDistance, 0.f);
+    return traverse(origin, direction / length, maxDistance);
+}
+
+void CollisionMask::raycastFan(sf::Vector2f origin, float heading, std::size_t rayCount, float fov,
+                               float maxDistance, float* distances) const {
+    if (rayCount == 0) return;
+    constexpr float DEG_TO_RAD = 3.14159265f / 180.f;
+
+    // Premier rayon sur le bord gauche, puis rotation incrémentale : deux paires sin/cos par éventail
+    float start = (heading - (rayCount > 1 ? fov / 2.f : 0.f)) * DEG_TO_RAD;
+    float step = rayCount > 1 ? fov / static_cast<float>(rayCount - 1) * DEG_TO_RAD : 0.f;
+    sf::Vector2f direction(std::cos(start), std::sin(start));
+    const float stepCos = std::cos(step);
+    const float stepSin = std::sin(step);
+    for (std::size_t r = 0; r < rayCount; ++r) {
+        distances[r] = traverse(origin, direction, maxDistance);
+        direction = {direction.x * stepCos - direction.y * stepSin, direction.x * stepSin + direction.y * stepCos};
+    }
+}
+
+float CollisionMask::traverse(sf::Vector2f origin, sf::Vector2f direction, float maxDistance) const {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    const float width = static_cast<float>(mSize.x);
+    const float height = static_cast<float>(mSize.y);
+
+    // Passage en pixels du masque : t est la distance parcourue en pixels depuis l'origine
+    const float ox = origin.x * mScale;
+    const float oy = origin.y * mScale;
+    const float dx = direction.x;
+    const float dy = direction.y;
+
+    // 1. Découpage par la grille (hors map = herbe : aucun mur au-delà)
+    float tEnter = 0.f;
+    float tExit = maxDistance * mScale;
+    auto clip = [&](float o, float d, float size) {
+        if (d == 0.f) return o >= 0.f && o < size;
+        float t0 = -o / d;
+        float t1 = (size - o) / d;
+        tEnter = std::max(tEnter, std::min(t0, t1));
+        tExit = std::min(tExit, std::max(t0, t1));
+        return true;
+    };
+    if (!clip(ox, dx, width) || !clip(oy, dy, height) || tEnter >= tExit) return maxDistance;
+
+    // 2. Case d'entrée et prochaines frontières verticale / horizontale
+    int cx = std::clamp(static_cast<int>(std::floor(ox + dx * tEnter)), 0, static_cast<int>(mSize.x) - 1);
+    int cy = std::clamp(static_cast<int>(std::floor(oy + dy * tEnter)), 0, static_cast<int>(mSize.y) - 1);
+    const int stepX = dx > 0.f ? 1 : -1;
+    const int stepY = dy > 0.f ? 1 : -1;
+    const float deltaX = dx != 0.f ? std::abs(1.f / dx) : INF;
+    const float deltaY = dy != 0.f ? std::abs(1.f / dy) : INF;
+    float nextX = dx > 0.f ? (static_cast<float>(cx + 1) - ox) / dx : dx < 0.f ? (static_cast<float>(cx) - ox) / dx : INF;
+    float nextY = dy > 0.f ? (static_cast<float>(cy + 1) - oy) / dy : dy < 0.f ? (static_cast<float>(cy) - oy) / dy : INF;
+
+    // 3. Parcours case par case, arrêt au premier mur ; chaque case lue compte comme une requête
+    const TerrainType* grid = mGrid.data();
+    float t = tEnter;
+    std::uint32_t cells = 0;
+    while (t < tExit) {
+        ++cells;
+        if (grid[cx + cy * static_cast<int>(mSize.x)] == TerrainType::WALL) {
+            Profiler::countTerrainQueries(cells);
+            return t / mScale;
+        }
+        if (nextX < nextY) {
+            t = nextX;
+            nextX += deltaX;
+            cx += stepX;
+            if (cx < 0 || cx >= static_cast<int>(mSize.x)) break;
+        } else {
+            t = nextY;
+            nextY += deltaY;
+            cy += stepY;
+            if (cy < 0 || cy >= static_cast<int>(mSize.y)) break;
+        }
+    }
+    Profiler::countTerrainQueries(cells);
+    return maxDistance;
+}
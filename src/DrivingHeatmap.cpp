@@ -0,0 +1,247 @@
+#include "DrivingHeatmap.h"
+#include "GhostManager.h"
+#include "HeadlessTrack.h"
+#include "Config.h"
+#include "Profiler.h"
+#include "TelemetryReader.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+
+namespace {
+    // Une tranche de travail : un bloc de télémétrie ou un fantôme entier
+    struct Slice {
+        const TelemetryReader* reader;
+        std::size_t chunk;
+        const std::vector<GhostPoint>* ghost;
+    };
+
+    // Dossiers remplacés par les enregistrements qu'ils contiennent (*.rrt, fantômes *.dat), triés par nom
+    std::vector<std::string> expandInputs(const std::vector<std::string>& paths) {
+        std::vector<std::string> files;
+        for (const std::string& path : paths) {
+            std::error_code ec;
+            if (!std::filesystem::is_directory(path, ec)) {
+                files.push_back(path);
+                continue;
+            }
+            std::size_t first = files.size();
+            // Incrément sans exception : un sous-dossier illisible arrête seulement le parcours
+            for (std::filesystem::recursive_directory_iterator it(path, ec), end; !ec && it != end; it.increment(ec)) {
+                std::string extension = it->path().extension().string();
+                if (it->is_regular_file(ec) && (extension == ".rrt" || extension == ".dat")) files.push_back(it->path().string());
+            }
+            std::sort(files.begin() + static_cast<std::ptrdiff_t>(first), files.end());
+            if (files.size() == first) std::cout << "Heatmap: no recording in " << path << std::endl;
+        }
+        return files;
+    }
+
+    // Lent -> rapide : rouge, jaune, vert
+    sf::Color speedColor(float ratio) {
+        ratio = std::clamp(ratio, 0.f, 1.f);
+        if (ratio < 0.5f) return sf::Color(255, static_cast<std::uint8_t>(ratio * 2.f * 255.f), 0);
+        return sf::Color(static_cast<std::uint8_t>((1.f - ratio) * 2.f * 255.f), 255, 0);
+    }
+}
+
+DrivingHeatmap::DrivingHeatmap(sf::Vector2u maskSize, sf::Vector2f worldSize) {
+    unsigned int cell = Config::HEATMAP_CELL;
+    mGridSize = {(maskSize.x + cell - 1) / cell, (maskSize.y + cell - 1) / cell};
+    mWorldToGrid = {maskSize.x / (worldSize.x * cell), maskSize.y / (worldSize.y * cell)};
+    mBins.resize(static_cast<std::size_t>(mGridSize.x) * mGridSize.y);
+}
+
+void DrivingHeatmap::binSample(std::vector<Bin>& grid, float x, float y, float speed) const {
+    float gx = x * mWorldToGrid.x;
+    float gy = y * mWorldToGrid.y;
+    if (gx < 0.f || gy < 0.f || gx >= mGridSize.x || gy >= mGridSize.y) return;
+    Bin& bin = grid[static_cast<std::size_t>(gy) * mGridSize.x + static_cast<std::size_t>(gx)];
+    bin.count++;
+    bin.speedSum += speed;
+}
+
+std::size_t DrivingHeatmap::addFiles(const std::vector<std::string>& inputs, ThreadPool& threadPool) {
+    std::vector<std::string> paths = expandInputs(inputs);
+
+    // Ouverture : télémétrie mappée (index des blocs seulement), fantômes lus en entier
+    std::vector<std::unique_ptr<TelemetryReader>> readers;
+    std::vector<GhostData> ghosts;
+    ghosts.reserve(paths.size()); // Adresses stables pour les tranches
+    std::vector<Slice> slices;
+    std::size_t filesRead = 0;
+    for (const std::string& path : paths) {
+        auto reader = std::make_unique<TelemetryReader>();
+        if (reader->open(path)) {
+            for (std::size_t c = 0; c < reader->getChunks().size(); ++c) slices.push_back({reader.get(), c, nullptr});
+            readers.push_back(std::move(reader));
+            filesRead++;
+            continue;
+        }
+        GhostData ghost;
+        if (ghost.loadFromFile(path)) {
+            ghosts.push_back(std::move(ghost));
+            slices.push_back({nullptr, 0, &ghosts.back().mPoints});
+            filesRead++;
+        } else {
+            std::cout << "Heatmap: cannot read " << path << std::endl;
+        }
+    }
+    if (slices.empty()) return filesRead;
+
+    // Une grille locale par part : aucun verrou pendant le binning
+    std::size_t parts = std::min<std::size_t>(slices.size(), threadPool.getThreadCount() + 1);
+    std::vector<std::vector<Bin>> locals(parts);
+    std::vector<std::uint64_t> localSamples(parts, 0);
+    threadPool.parallelFor(parts, [&](std::size_t begin, std::size_t end) {
+        std::vector<float> xs, ys, vx, vy;
+        for (std::size_t part = begin; part < end; ++part) {
+            std::vector<Bin>& grid = locals[part];
+            grid.resize(mBins.size());
+            std::size_t first = slices.size() * part / parts;
+            std::size_t last = slices.size() * (part + 1) / parts;
+            for (std::size_t s = first; s < last; ++s) {
+                const Slice& slice = slices[s];
+                if (slice.reader) {
+                    // Colonnes décodées directement depuis le mapping
+                    if (!slice.reader->readFloats(slice.chunk, TelemetryFormat::PositionX, xs) ||
+                        !slice.reader->readFloats(slice.chunk, TelemetryFormat::PositionY, ys) ||
+                        !slice.reader->readFloats(slice.chunk, TelemetryFormat::VelocityX, vx) ||
+                        !slice.reader->readFloats(slice.chunk, TelemetryFormat::VelocityY, vy)) continue;
+                    for (std::size_t i = 0; i < xs.size(); ++i) {
+                        binSample(grid, xs[i], ys[i], std::sqrt(vx[i] * vx[i] + vy[i] * vy[i]));
+                    }
+                    localSamples[part] += xs.size();
+                } else {
+                    // Fantôme : vitesse tirée de l'écart entre deux points enregistrés
+                    const std::vector<GhostPoint>& points = *slice.ghost;
+                    for (std::size_t i = 1; i < points.size(); ++i) {
+                        sf::Vector2f delta = points[i].position - points[i - 1].position;
+                        binSample(grid, points[i].position.x, points[i].position.y, delta.length() * Config::FPS);
+                    }
+                    localSamples[part] += points.size() > 0 ? points.size() - 1 : 0;
+                }
+            }
+        }
+    });
+
+    // Réduction : chaque thread somme une plage de cases sur toutes les grilles locales
+    threadPool.parallelFor(mBins.size(), [&](std::size_t begin, std::size_t end) {
+        for (const std::vector<Bin>& grid : locals) {
+            for (std::size_t i = begin; i < end; ++i) {
+                mBins[i].count += grid[i].count;
+                mBins[i].speedSum += grid[i].speedSum;
+            }
+        }
+    });
+    for (std::uint64_t samples : localSamples) mSamples += samples;
+    return filesRead;
+}
+
+std::vector<std::uint8_t> DrivingHeatmap::colorize(const CollisionMask* mask) const {
+    std::vector<std::uint8_t> pixels(mBins.size() * 4, 0);
+
+    // Opacité en log de la densité : les passages rares restent visibles
+    std::uint32_t maxCount = 1;
+    for (const Bin& bin : mBins) maxCount = std::max(maxCount, bin.count);
+    float logMax = std::log1p(static_cast<float>(maxCount));
+
+    const std::vector<TerrainType>* grid = mask ? &mask->getGrid() : nullptr;
+    sf::Vector2u maskSize = mask ? mask->getSize() : sf::Vector2u();
+    for (unsigned int y = 0; y < mGridSize.y; ++y) {
+        for (unsigned int x = 0; x < mGridSize.x; ++x) {
+            std::size_t i = static_cast<std::size_t>(y) * mGridSize.x + x;
+            std::uint8_t* out = &pixels[i * 4];
+
+            if (grid) {
+                // Fond : terrain au centre de la case, assombri
+                unsigned int mx = std::min(x * Config::HEATMAP_CELL + Config::HEATMAP_CELL / 2, maskSize.x - 1);
+                unsigned int my = std::min(y * Config::HEATMAP_CELL + Config::HEATMAP_CELL / 2, maskSize.y - 1);
+                TerrainType type = (*grid)[static_cast<std::size_t>(my) * maskSize.x + mx];
+                std::uint8_t shade = type == TerrainType::WALL ? 200 : (type == TerrainType::GRASS ? 25 : 60);
+                out[0] = out[1] = out[2] = shade;
+                out[3] = 255;
+            }
+
+            const Bin& bin = mBins[i];
+            if (bin.count < Config::HEATMAP_MIN_SAMPLES) continue;
+            sf::Color heat = speedColor(bin.speedSum / bin.count / Config::CAR_MAX_SPEED);
+            float alpha = 0.35f + 0.65f * std::log1p(static_cast<float>(bin.count)) / logMax;
+            if (grid) {
+                out[0] = static_cast<std::uint8_t>(out[0] + (heat.r - out[0]) * alpha);
+                out[1] = static_cast<std::uint8_t>(out[1] + (heat.g - out[1]) * alpha);
+                out[2] = static_cast<std::uint8_t>(out[2] + (heat.b - out[2]) * alpha);
+            } else {
+                out[0] = heat.r;
+                out[1] = heat.g;
+                out[2] = heat.b;
+                out[3] = static_cast<std::uint8_t>(alpha * Config::HEATMAP_OVERLAY_ALPHA);
+            }
+        }
+    }
+    return pixels;
+}
+
+void DrivingHeatmap::createTexture() {
+    std::vector<std::uint8_t> pixels = colorize(nullptr);
+    if (mTexture.resize(mGridSize)) {
+        mTexture.update(pixels.data());
+        mTexture.setSmooth(true);
+    }
+}
+
+void DrivingHeatmap::render(sf::RenderTarget& target) const {
+    // Un quad couvrant le circuit : une case par texel
+    sf::Sprite sprite(mTexture);
+    sprite.setScale({1.f / mWorldToGrid.x, 1.f / mWorldToGrid.y});
+    target.draw(sprite);
+    Profiler::countDrawCall(4);
+}
+
+sf::Vector2u DrivingHeatmap::getGridSize() const { return mGridSize; }
+std::uint64_t DrivingHeatmap::getSampleCount() const { return mSamples; }
+
+int DrivingHeatmap::runTool(const std::vector<std::string>& inputs, const std::string& outputPath) {
+    ThreadPool threadPool;
+    HeadlessTrack track("Heatmap");
+    if (!track.load(threadPool)) return 1;
+    const CollisionMask& mask = track.getMask();
+
+    // Échelle monde identique à World::finishLoading (circuit et masque de même taille)
+    sf::Vector2u maskSize = mask.getSize();
+    float scale = track.getScale();
+    DrivingHeatmap heatmap(maskSize, {maskSize.x * scale, maskSize.y * scale});
+
+    sf::Clock clock;
+    std::size_t files = heatmap.addFiles(inputs, threadPool);
+    std::cout << "Heatmap: " << files << " files, " << heatmap.getSampleCount() << " samples binned in "
+              << clock.getElapsedTime().asMilliseconds() << " ms" << std::endl;
+
+    sf::Vector2u gridSize = heatmap.getGridSize();
+    std::vector<std::uint8_t> pixels = heatmap.colorize(&mask);
+    sf::Image image(gridSize, pixels.data());
+    if (!image.saveToFile(outputPath)) {
+        std::cerr << "Heatmap: cannot write " << outputPath << std::endl;
+        return 1;
+    }
+    std::cout << "Heatmap written to " << outputPath << " (" << gridSize.x << "x" << gridSize.y << ")" << std::endl;
+
+    // Cases fréquentées les plus lentes : là où le temps se perd
+    std::vector<std::size_t> visited;
+    for (std::size_t i = 0; i < heatmap.mBins.size(); ++i) {
+        if (heatmap.mBins[i].count >= Config::HEATMAP_MIN_SAMPLES) visited.push_back(i);
+    }
+    auto meanSpeed = [&](std::size_t i) { return heatmap.mBins[i].speedSum / heatmap.mBins[i].count; };
+    std::size_t shown = std::min<std::size_t>(visited.size(), 10);
+    std::partial_sort(visited.begin(), visited.begin() + static_cast<std::ptrdiff_t>(shown), visited.end(),
+                      [&](std::size_t a, std::size_t b) { return meanSpeed(a) < meanSpeed(b); });
+    for (std::size_t k = 0; k < shown; ++k) {
+        std::size_t i = visited[k];
+        sf::Vector2f world((i % gridSize.x + 0.5f) / heatmap.mWorldToGrid.x, (i / gridSize.x + 0.5f) / heatmap.mWorldToGrid.y);
+        std::cout << "  slow cell at (" << world.x << ", " << world.y << "): " << meanSpeed(i) * 3.6f
+                  << " km/h over " << heatmap.mBins[i].count << " samples" << std::endl;
+    }
+    return 0;
+}
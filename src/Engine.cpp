@@ -1,8 +1,12 @@
 #include "Engine.h"
 #include "Config.h"
-#include "ScoreManager.h"
+#include "Profiler.h"
+#include "StartupPipeline.h"
+#include <iostream>
 #include <SFML/Window/Joystick.hpp>
 #include <stdexcept>
+#include <chrono>
+#include <filesystem>
 
 // --- FONCTION UTILITAIRE ---
 static void adjustView(const sf::Vector2u& windowSize, sf::View& view, float targetRatio) {
@@ -16,41 +20,195 @@ static void adjustView(const sf::Vector2u& windowSize, sf::View& view, float tar
     }
 }
 
-Engine::Engine()
-    : mCamera(sf::FloatRect({0.f, 0.f}, {Config::CAMERA_WIDTH, Config::CAMERA_HEIGHT})),
+Engine::Engine(const LaunchOptions& options)
+    : mStartupBegin(std::chrono::steady_clock::now()),
+      mOptions(options),
+      mCamera(sf::FloatRect({0.f, 0.f}, {Config::CAMERA_WIDTH, Config::CAMERA_HEIGHT})),
       mTimePerFrame(sf::seconds(Config::TIME_PER_FRAME)),
+      mPacer(Config::FRAME_LIMIT),
+      mActivePacing(FramePacer::Mode::Paced),
+      mGovernor(1000.f / static_cast<float>(Config::FRAME_LIMIT > 0 ? Config::FRAME_LIMIT : 60)),
       mIsFullscreen(true),
       mHasFocus(true)
 {
     mContextSettings.antiAliasingLevel = Config::ANTIALIASING_LEVEL;
 
-    recreateWindow();
+    // Avec la VSync, c'est le driver qui cadence la présentation
+    if (mOptions.uncapped || Config::ENABLE_VSYNC || Config::FRAME_LIMIT == 0) {
+        mActivePacing = FramePacer::Mode::Uncapped;
+    }
+    mPacer.setMode(mActivePacing);
 
-    unsigned int maxTextureSize = sf::Texture::getMaximumSize();
-    bool useSD = (maxTextureSize <= Config::TEXTURE_LIMIT_THRESHOLD);
-    mAssetsManager.setUseSDAssets(useSD);
-    std::string circuitFile = useSD ? Config::FILE_CIRCUIT_SD : Config::FILE_CIRCUIT_HD;
+    if (!mOptions.latencyCsv.empty()) {
+        mLatency = std::make_unique<LatencyTracker>(mOptions.latencyCsv);
+        mInput.setLatencyTracker(mLatency.get());
+    }
+    if (!mOptions.telemetryPath.empty()) {
+        mTelemetry = std::make_unique<TelemetryRecorder>(mOptions.telemetryPath);
+    }
 
-    if (!mAssetsManager.loadTexture("circuit", Config::TEXTURES_PATH + circuitFile) ||
-        !mAssetsManager.loadTexture("voiture", Config::TEXTURES_PATH + "voiture.png")) {
-        throw std::runtime_error("Failed to load textures");
+    // Sauvegardes regroupées sous SAVE_PATH ; celles d'une version précédente (dossier courant) y sont déplacées
+    std::error_code ec;
+    std::filesystem::create_directories(Config::SAVE_PATH, ec);
+    for (const std::string& file : {Config::SCORE_SNAPSHOT_FILE, Config::SCORE_LOG_FILE, Config::GHOST_FILE, Config::REFERENCE_GHOST_FILE}) {
+        std::string legacy = std::filesystem::path(file).filename().string();
+        if (!std::filesystem::exists(file, ec) && std::filesystem::exists(legacy, ec)) std::filesystem::rename(legacy, file, ec);
     }
 
-    mWorld = std::make_unique<World>(mWindow, mAssetsManager);
+    recreateWindow();
+
+    // Archive mappée si présente ; sinon, fichiers séparés sous assets/
+    if (!mAssetsManager.openArchive(Config::ASSET_ARCHIVE_PATH)) {
+        std::cout << "No asset archive at " << Config::ASSET_ARCHIVE_PATH << ", using loose files" << std::endl;
+    }
+
+    World::selectResolution(mAssetsManager);
+
+    loadResources();
+}
+
+void Engine::loadResources() {
+    using Status = StartupPipeline::Status;
+    using Thread = StartupPipeline::Thread;
+    StartupPipeline pipeline(mThreadPool);
+
+    // Graphe de chargement : décodages en parallèle sur les workers,
+    // envois GPU et créations d'objets groupés sur le thread principal
+    TextureHandle spriteAtlas;
+    FontHandle font;
+    auto fontTask = pipeline.addTask("font", Thread::Main, {}, [&]() {
+        font = mAssetsManager.loadFont("arial", Config::FONTS_PATH + "arial.ttf");
+        return font.isValid() ? Status::Done : Status::Failed;
+    });
+    auto glyphs = pipeline.addTask("hud glyphs", Thread::Main, {fontTask}, [&]() {
+        // Glyphes rastérisés une fois ; leur page rejoint l'atlas de sprites
+        mHud = std::make_unique<HUD>(mAssetsManager.getFont(font));
+        mAssetsManager.addAtlasImage(Config::SPRITE_HUD_GLYPHS, mHud->getGlyphAtlas().copyPage());
+        return Status::Done;
+    });
+    auto carDecode = pipeline.addTask("car decode", Thread::Worker, {}, [&]() {
+        bool ok = mAssetsManager.addAtlasImage(Config::SPRITE_CAR, Config::TEXTURES_PATH + "voiture.png");
+        return ok ? Status::Done : Status::Failed;
+    });
+    auto atlas = pipeline.addTask("sprite atlas", Thread::Main, {glyphs, carDecode}, [&]() {
+        // Voiture, fantôme et HUD dans une seule texture : plus de changement de texture entre eux
+        spriteAtlas = mAssetsManager.buildAtlas("sprites");
+        if (!spriteAtlas.isValid()) return Status::Failed;
+        mHud->useSpriteAtlas(mAssetsManager.getTexture(spriteAtlas), mAssetsManager.getAtlasRegion(Config::SPRITE_HUD_GLYPHS));
+        return Status::Done;
+    });
+    // Gros décodages sans dépendance : ils démarrent dès le premier poll, en parallèle de la police et de l'atlas
+    auto circuit = std::make_unique<Track>(mThreadPool);
+    CollisionMask collisionMask;
+    auto track = pipeline.addTask("circuit decode", Thread::Worker, {}, [&]() {
+        World::decodeTrack(*circuit, mAssetsManager);
+        return Status::Done;
+    });
+    auto mask = pipeline.addTask("collision mask", Thread::Worker, {}, [&]() {
+        World::decodeCollisionMask(collisionMask, mAssetsManager, mThreadPool);
+        return Status::Done;
+    });
+    auto world = pipeline.addTask("world", Thread::Main, {atlas, track, mask}, [&]() {
+        // Les sous-systèmes reçoivent des handles et des régions, plus de recherche par nom
+        mWorld = std::make_unique<World>(mWindow, mAssetsManager, spriteAtlas, mThreadPool, std::move(circuit), std::move(collisionMask));
+        return Status::Done;
+    });
+    auto scores = pipeline.addTask("scores", Thread::Worker, {world}, [&]() {
+        mScores.load(mWorld->getTrackId());
+        return Status::Done;
+    });
+    auto centerline = pipeline.addTask("centerline", Thread::Worker, {world}, [&]() {
+        mWorld->loadCenterline();
+        return Status::Done;
+    });
+    auto worldUpload = pipeline.addTask("world upload", Thread::Main, {world}, [&]() {
+        mWorld->finishLoading();
+        return Status::Done;
+    });
+    if (!mOptions.heatmapInputs.empty()) {
+        auto heatmap = pipeline.addTask("heatmap", Thread::Worker, {worldUpload}, [&]() {
+            mWorld->buildHeatmap(mOptions.heatmapInputs);
+            return Status::Done;
+        });
+        pipeline.addTask("heatmap upload", Thread::Main, {heatmap}, [&]() {
+            mWorld->uploadHeatmap();
+            return Status::Done;
+        });
+    }
+    pipeline.addTask("interface", Thread::Main, {worldUpload, scores, centerline}, [&]() {
+        mMenu = std::make_unique<Menu>(mAssetsManager.getFont(font), mWorld->getTrack());
+        mMenu->updateHighScores(mScores.getTable(mWorld->getTrackId()));
+        mWorld->spawnDrivers(mOptions.aiDrivers);
+        mCameraManager = std::make_unique<Camera>(Config::CAMERA_WIDTH, Config::CAMERA_HEIGHT);
+        mGameManager = std::make_unique<GameManager>();
+
+        mCameraManager->update(mCamera, mWorld->getCar().getPosition(), mWorld->getTrackBounds().size);
+
+        // Correction : Utilisation de la nouvelle méthode ajoutée au GhostManager
+        mHud->setBestTimes(mWorld->getGhost().getBestTimes());
+        return Status::Done;
+    });
+
+    // Écran de chargement entre deux passes du pipeline
+    bool firstFrame = true;
+    while (!pipeline.isFinished()) {
+        pipeline.poll();
+
+        while (auto event = mWindow.pollEvent()) {
+            if (event->is<sf::Event::Closed>()) {
+                // Plus rien ne démarre ; on n'attend que les workers en vol, puis run() quitte aussitôt
+                mWindow.close();
+                pipeline.cancel();
+            }
+        }
+        if (mWindow.isOpen()) {
+            renderLoadingScreen(pipeline.getProgress(), pipeline.getCurrentLabel(), font.isValid() ? &mAssetsManager.getFont(font) : nullptr);
+            if (firstFrame) {
+                firstFrame = false;
+                std::cout << "Startup: first frame after " << msSinceStartup() << " ms" << std::endl;
+            }
+        }
+        mPacer.waitForNextFrame();
+    }
 
-    if (!mAssetsManager.loadFont("arial", Config::FONTS_PATH + "arial.ttf")) {
-        throw std::runtime_error("Failed to load font arial");
+    if (!mWindow.isOpen()) return;
+    if (pipeline.hasFailed()) {
+        throw std::runtime_error(pipeline.getError());
     }
+    pipeline.printTimings();
+}
 
-    mMenu = std::make_unique<Menu>(mAssetsManager.getFont("arial"), mAssetsManager.getTexture("circuit"));
-    mHud = std::make_unique<HUD>(mAssetsManager.getFont("arial"));
-    mCameraManager = std::make_unique<Camera>(Config::CAMERA_WIDTH, Config::CAMERA_HEIGHT);
-    mGameManager = std::make_unique<GameManager>();
+void Engine::renderLoadingScreen(float progress, const std::string& label, const sf::Font* font) {
+    mWindow.setView(mWindow.getDefaultView());
+    mWindow.clear(sf::Color(20, 20, 20));
+
+    sf::Vector2f size(mWindow.getSize());
+    sf::Vector2f barSize(size.x * 0.5f, 12.f);
+    sf::Vector2f barPos((size.x - barSize.x) / 2.f, size.y * 0.6f);
+
+    sf::RectangleShape background(barSize);
+    background.setPosition(barPos);
+    background.setFillColor(sf::Color(60, 60, 60));
+    mWindow.draw(background);
+
+    sf::RectangleShape bar({barSize.x * progress, barSize.y});
+    bar.setPosition(barPos);
+    bar.setFillColor(sf::Color(255, 200, 0));
+    mWindow.draw(bar);
+
+    // La police est elle-même chargée par le pipeline : texte dès qu'elle est prête
+    if (font) {
+        sf::Text text(*font, "Chargement : " + label, 20);
+        text.setFillColor(sf::Color::White);
+        text.setPosition({barPos.x, barPos.y - 32.f});
+        mWindow.draw(text);
+    }
 
-    mCameraManager->update(mCamera, mWorld->getCar().getPosition(), mWorld->getTrackBounds().size);
+    mWindow.display();
+}
 
-    // Correction : Utilisation de la nouvelle méthode ajoutée au GhostManager
-    mHud->setBestTimes(mWorld->getGhost().getBestTimes());
+float Engine::msSinceStartup() const {
+    return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - mStartupBegin).count();
 }
 
 void Engine::recreateWindow() {
@@ -61,6 +219,8 @@ void Engine::recreateWindow() {
     auto state = mIsFullscreen ? sf::State::Fullscreen : sf::State::Windowed;
 
     mWindow.create(mode, "RetroRush", style, state, mContextSettings);
+    // Un appui = un KeyPressed : la répétition du système fausserait la file d'entrées et les mesures de latence
+    mWindow.setKeyRepeatEnabled(false);
 
     if (!mIsFullscreen) {
         auto desktop = sf::VideoMode::getDesktopMode();
@@ -70,38 +230,54 @@ void Engine::recreateWindow() {
         });
     }
 
-    mWindow.setVerticalSyncEnabled(Config::ENABLE_VSYNC);
-    mWindow.setFramerateLimit(Config::FRAME_LIMIT);
+    // Pas de setFramerateLimit : la cadence est gérée par FramePacer
+    mWindow.setVerticalSyncEnabled(Config::ENABLE_VSYNC && !mOptions.uncapped);
 
     mWindow.setMouseCursorVisible(!mIsFullscreen);
     adjustView(mWindow.getSize(), mCamera, Config::CAMERA_WIDTH / Config::CAMERA_HEIGHT);
 }
 
 void Engine::run() {
-    sf::Clock clock;
     sf::Time timeSinceLastUpdate = sf::Time::Zero;
     sf::Clock fpsClock;
     int frameCount = 0;
 
+    // Le temps de chargement ne doit pas arriver comme un seul delta (rafale de ticks de rattrapage)
+    mPacer.resync();
+
     while (mWindow.isOpen()) {
+        // Attente en tête de boucle : les entrées sont lues juste après le réveil
+        mPacer.waitForNextFrame();
+        Profiler::beginFrame();
         processEvents();
 
-        if (!mHasFocus) {
-            sf::sleep(sf::milliseconds(100));
-            clock.restart();
-            continue;
+        // Sans focus, le pacer est en mode veille (pas de spin, cadence réduite)
+        if (!mHasFocus) continue;
+
+        // Menu : image statique en cache, cadence réduite suffisante pour le clignotement
+        bool inMenu = mGameManager->isInMenu() || mGameManager->isFinished();
+        if (inMenu != mMenuPacing) {
+            mMenuPacing = inMenu;
+            applyPacing();
         }
 
-        sf::Time deltaTime = clock.restart();
-        timeSinceLastUpdate += deltaTime;
+        sf::Time deltaTime = mPacer.getFrameTime();
+        timeSinceLastUpdate += mPacer.alignToStep(deltaTime, mTimePerFrame);
+        InputManager::Clock::time_point frameStamp = InputManager::Clock::now();
 
         if (timeSinceLastUpdate > sf::seconds(0.2f)) {
             timeSinceLastUpdate = sf::seconds(0.2f);
         }
 
-        while (timeSinceLastUpdate > mTimePerFrame) {
+        while (timeSinceLastUpdate >= mTimePerFrame) {
             timeSinceLastUpdate -= mTimePerFrame;
-            update(mTimePerFrame);
+
+            // Fin de la fenêtre du tick en temps réel : la simulation a
+            // 'timeSinceLastUpdate' de retard sur l'horloge une fois ce tick joué.
+            auto lag = std::chrono::microseconds(timeSinceLastUpdate.asMicroseconds());
+            Profiler::beginTick();
+            update(mTimePerFrame, frameStamp - lag);
+            Profiler::endTick();
         }
 
         frameCount++;
@@ -113,7 +289,20 @@ void Engine::run() {
 
         float alpha = timeSinceLastUpdate.asSeconds() / mTimePerFrame.asSeconds();
         render(alpha);
+        Profiler::endFrame(deltaTime, mPacer.getJitterMs());
+
+        if (!mInteractive) {
+            mInteractive = true;
+            std::cout << "Startup: interactive after " << msSinceStartup() << " ms" << std::endl;
+        }
+
+        // Qualité ajustée à la charge réelle, uniquement en course
+        if (mGameManager->isPlaying() && mGovernor.update(Profiler::getWorkMs())) {
+            mWorld->setQuality(mGovernor.getSettings());
+        }
     }
+
+    if (mLatency) mLatency->report();
 }
 
 void Engine::toggleFullscreen() {
@@ -121,9 +310,21 @@ void Engine::toggleFullscreen() {
     recreateWindow();
 }
 
+void Engine::applyPacing() {
+    if (!mHasFocus) {
+        mPacer.setMode(FramePacer::Mode::Idle);
+    } else if (mMenuPacing && mActivePacing == FramePacer::Mode::Paced) {
+        // Menu : sommeil seul, sans spin ; --uncapped et la VSync gardent la main
+        mPacer.setMode(FramePacer::Mode::Menu);
+    } else {
+        mPacer.setMode(mActivePacing);
+    }
+}
+
 void Engine::processEvents() {
     while (auto eventOpt = mWindow.pollEvent()) {
         const sf::Event& event = *eventOpt;
+        mInput.handleEvent(event, InputManager::Clock::now());
 
         if (event.is<sf::Event::Closed>()) {
             mWindow.close();
@@ -133,13 +334,18 @@ void Engine::processEvents() {
         }
         else if (event.is<sf::Event::FocusLost>()) {
             mHasFocus = false;
+            applyPacing();
+            mInput.reset(); // Les relâchements de touches hors focus seraient perdus
         }
         else if (event.is<sf::Event::FocusGained>()) {
             mHasFocus = true;
+            applyPacing();
         }
         else if (const auto* keyEvent = event.getIf<sf::Event::KeyPressed>()) {
             if (keyEvent->code == sf::Keyboard::Key::Escape) mWindow.close();
             else if (keyEvent->code == sf::Keyboard::Key::F11) toggleFullscreen();
+            else if (keyEvent->code == sf::Keyboard::Key::F3) mHud->toggleOverlay();
+            else if (keyEvent->code == sf::Keyboard::Key::F4) mWorld->toggleHeatmap();
         }
 
         if (!mHasFocus) continue;
@@ -156,8 +362,10 @@ void Engine::processEvents() {
 
             if (startRequested) {
                 if (mGameManager->isFinished()) {
-                    ScoreManager::saveTime(mGameManager->getRaceTime());
-                    mMenu->updateHighScores();
+                    // Insertion en mémoire ; l'écriture disque part sur le thread du ScoreStore
+                    const std::string& track = mWorld->getTrackId();
+                    mScores.submit(track, mGameManager->getRaceTime(), mWorld->getGhost().saveLastReplay(track));
+                    mMenu->updateHighScores(mScores.getTable(track));
                 }
                 mGameManager->reset();
                 mGameManager->startCountdown();
@@ -168,7 +376,10 @@ void Engine::processEvents() {
     }
 }
 
-void Engine::update(sf::Time deltaTime) {
+void Engine::update(sf::Time deltaTime, InputManager::Clock::time_point tickEnd) {
+    // Consommé à chaque tick, même hors course, pour que la file ne vieillisse pas
+    CarControls controls = mInput.consumeTick(tickEnd);
+
     bool justStarted = mGameManager->justStartedRace();
     mGameManager->update();
 
@@ -183,7 +394,9 @@ void Engine::update(sf::Time deltaTime) {
     }
 
     if (mGameManager->isPlaying()) {
-        mWorld->update(deltaTime, mCamera);
+        mWorld->update(deltaTime, controls, mCamera);
+        if (mLatency) mLatency->commitTick(mTickCount, tickEnd);
+        if (mTelemetry) recordTelemetry(controls);
 
         if (mWorld->isLapComplete() && mWorld->getLapCount() >= 1) {
             mGameManager->markLapFinished(mGameManager->getRaceTime());
@@ -194,6 +407,30 @@ void Engine::update(sf::Time deltaTime) {
     float speed = mWorld->getCar().getSpeed() * 3.6f;
     int countdown = mGameManager->isCountdown() ? mGameManager->getCountdownValue() : -2;
     mHud->update(speed, mGameManager->getRaceTime(), countdown, mWindow.getSize());
+
+    // Entrées consommées sans atteindre Car::update (menu, compte à rebours)
+    if (mLatency) mLatency->discardTick();
+    mTickCount++;
+}
+
+void Engine::recordTelemetry(const CarControls& controls) {
+    const Car& car = mWorld->getCar();
+    TelemetrySample sample;
+    sf::Vector2f position = car.getPosition();
+    sf::Vector2f velocity = car.getVelocity();
+    sample.position[0] = position.x;
+    sample.position[1] = position.y;
+    sample.velocity[0] = velocity.x;
+    sample.velocity[1] = velocity.y;
+    sample.heading = car.getRotation();
+    sample.steer = car.getSteer();
+    sample.grass = car.getGrassIntensity();
+    sample.terrain = static_cast<std::uint8_t>(mWorld->getCarTerrain());
+    if (controls.accelerate) sample.inputs |= TelemetryFormat::INPUT_ACCELERATE;
+    if (controls.brake) sample.inputs |= TelemetryFormat::INPUT_BRAKE;
+    if (controls.turnLeft) sample.inputs |= TelemetryFormat::INPUT_LEFT;
+    if (controls.turnRight) sample.inputs |= TelemetryFormat::INPUT_RIGHT;
+    mTelemetry->record(mTickCount, sample);
 }
 
 void Engine::render(float alpha) {
@@ -208,12 +445,50 @@ void Engine::render(float alpha) {
             mCameraManager->update(mCamera, interpolatedCarPos, mWorld->getTrackBounds().size);
         }
 
-        mWindow.setView(mCamera);
-        mWorld->render(mGameManager->isPlaying(), alpha);
+        renderWorld(alpha);
 
         mWindow.setView(mWindow.getDefaultView());
+        mWorld->renderMinimap(mWindow, mGameManager->isPlaying(), alpha);
+        mHud->updateOverlay(mGovernor.getLevel());
         mHud->render(mWindow);
     }
 
     mWindow.display();
-}
\ No newline at end of file
+    if (mLatency) mLatency->recordPresent(alpha);
+}
+
+void Engine::renderWorld(float alpha) {
+    float scale = mGovernor.getSettings().renderScale;
+    sf::Vector2u windowSize = mWindow.getSize();
+    sf::Vector2u size(static_cast<unsigned int>(windowSize.x * scale), static_cast<unsigned int>(windowSize.y * scale));
+
+    // (Re)création seulement au changement de niveau ou de taille de fenêtre
+    // Échec de création (render textures non supportées) : pleine résolution, sans réessayer
+    if (scale < 1.f && size != mWorldTargetSize && !mWorldTargetFailed) {
+        mWorldTargetFailed = !mWorldTarget.resize(size);
+        mWorldTargetSize = mWorldTargetFailed ? sf::Vector2u() : size;
+        mWorldTarget.setSmooth(true);
+    }
+
+    if (scale >= 1.f || mWorldTargetSize != size) {
+        mWindow.setView(mCamera);
+        mWorld->render(mWindow, mGameManager->isPlaying(), alpha);
+        return;
+    }
+
+    // Monde rendu en basse résolution (même vue, même viewport), puis étiré sur la fenêtre
+    mWorldTarget.setView(mCamera);
+    mWorldTarget.clear(sf::Color(20, 20, 20));
+    mWorld->render(mWorldTarget, mGameManager->isPlaying(), alpha);
+    mWorldTarget.display();
+
+    sf::Vector2f w(windowSize), t(size);
+    sf::Vertex quad[6] = {
+        {{0.f, 0.f}, sf::Color::White, {0.f, 0.f}}, {{w.x, 0.f}, sf::Color::White, {t.x, 0.f}},
+        {{0.f, w.y}, sf::Color::White, {0.f, t.y}}, {{0.f, w.y}, sf::Color::White, {0.f, t.y}},
+        {{w.x, 0.f}, sf::Color::White, {t.x, 0.f}}, {{w.x, w.y}, sf::Color::White, {t.x, t.y}},
+    };
+    mWindow.setView(mWindow.getDefaultView());
+    mWindow.draw(quad, 6, sf::PrimitiveType::Triangles, sf::RenderStates(&mWorldTarget.getTexture()));
+    Profiler::countDrawCall(6);
+}
@@ -0,0 +1,139 @@
+#include "FramePacer.h"
+#include "Config.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace {
+    using namespace std::chrono;
+
+    constexpr auto MIN_SPIN_THRESHOLD = microseconds(500);
+    constexpr auto MAX_SPIN_THRESHOLD = milliseconds(4);
+    constexpr float JITTER_SMOOTHING = 0.05f;   // Lissage exponentiel de la gigue
+    constexpr float ALIGN_TOLERANCE = 0.002f;   // 2 ms : en dessous, on aligne sur le pas fixe
+
+    steady_clock::duration periodFromRate(unsigned int rate) {
+        if (rate == 0) return steady_clock::duration::zero();
+        return duration_cast<steady_clock::duration>(duration<double>(1.0 / rate));
+    }
+}
+
+FramePacer::FramePacer(unsigned int targetRate)
+    : mMode(targetRate == 0 ? Mode::Uncapped : Mode::Paced),
+      mPeriod(periodFromRate(targetRate)),
+      mDeadline(Clock::now()),
+      mLastFrame(mDeadline),
+      mFrameTime(mPeriod),
+      mSpinThreshold(milliseconds(2)),
+      mJitterMs(0.f),
+      mAlignDebt(0.f) {}
+
+void FramePacer::setTargetRate(unsigned int targetRate) {
+    mPeriod = periodFromRate(targetRate);
+    if (mMode == Mode::Paced || mMode == Mode::Uncapped) {
+        setMode(targetRate == 0 ? Mode::Uncapped : Mode::Paced);
+    }
+}
+
+void FramePacer::setMode(Mode mode) {
+    if (mode == Mode::Paced && mPeriod == Clock::duration::zero()) mode = Mode::Uncapped;
+    if (mode == mMode) return;
+
+    mMode = mode;
+
+    // La première frame après un changement de mode ne doit pas rapporter le temps passé en veille
+    resync();
+}
+
+void FramePacer::resync() {
+    Clock::time_point now = Clock::now();
+    mDeadline = now;
+    mLastFrame = now;
+    mFrameTime = currentPeriod();
+    mAlignDebt = 0.f;
+}
+
+FramePacer::Mode FramePacer::getMode() const {
+    return mMode;
+}
+
+FramePacer::Clock::duration FramePacer::currentPeriod() const {
+    switch (mMode) {
+        case Mode::Idle:     return periodFromRate(Config::IDLE_FRAME_RATE);
+        case Mode::Menu:     return periodFromRate(Config::MENU_FRAME_RATE);
+        case Mode::Uncapped: return Clock::duration::zero();
+        case Mode::Paced:    break;
+    }
+    return mPeriod;
+}
+
+void FramePacer::waitForNextFrame() {
+    Clock::duration period = currentPeriod();
+
+    if (period > Clock::duration::zero()) {
+        mDeadline += period;
+
+        // Trop en retard (chargement, fenêtre déplacée...) : on repart de maintenant
+        // plutôt que d'enchaîner des frames sans attente pour rattraper.
+        Clock::time_point now = Clock::now();
+        if (now > mDeadline + period) mDeadline = now;
+
+        sleepUntil(mDeadline, mMode == Mode::Paced);
+    }
+
+    Clock::time_point now = Clock::now();
+    mFrameTime = now - mLastFrame;
+    mLastFrame = now;
+
+    if (period > Clock::duration::zero()) {
+        float deviationMs = std::abs(duration<float, std::milli>(mFrameTime - period).count());
+        mJitterMs += (deviationMs - mJitterMs) * JITTER_SMOOTHING;
+    }
+}
+
+void FramePacer::sleepUntil(Clock::time_point deadline, bool allowSpin) {
+    if (!allowSpin) {
+        std::this_thread::sleep_until(deadline);
+        return;
+    }
+
+    // 1. Sommeil grossier jusqu'à la marge de spin
+    Clock::time_point wakeTarget = deadline - mSpinThreshold;
+    Clock::time_point before = Clock::now();
+    if (wakeTarget > before) {
+        std::this_thread::sleep_until(wakeTarget);
+
+        // Adaptation de la marge au dépassement réellement observé
+        Clock::duration overshoot = Clock::now() - wakeTarget;
+        Clock::duration target = overshoot + overshoot / 2;
+        mSpinThreshold += (target - mSpinThreshold) / 8;
+        mSpinThreshold = std::clamp<Clock::duration>(mSpinThreshold, MIN_SPIN_THRESHOLD, MAX_SPIN_THRESHOLD);
+    }
+
+    // 2. Attente active pour la fin (précision à la microseconde)
+    while (Clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+}
+
+sf::Time FramePacer::getFrameTime() const {
+    return sf::microseconds(duration_cast<microseconds>(mFrameTime).count());
+}
+
+float FramePacer::getJitterMs() const {
+    return mJitterMs;
+}
+
+sf::Time FramePacer::alignToStep(sf::Time frameTime, sf::Time step) {
+    float raw = frameTime.asSeconds() + mAlignDebt;
+    float stepSec = step.asSeconds();
+    float steps = std::round(raw / stepSec);
+
+    float aligned = raw;
+    if (steps >= 1.f && std::abs(raw - steps * stepSec) < ALIGN_TOLERANCE) {
+        aligned = steps * stepSec;
+    }
+
+    mAlignDebt = raw - aligned;
+    return sf::seconds(aligned);
+}
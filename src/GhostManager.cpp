@@ -1,12 +1,14 @@
 #include "GhostManager.h"
 #include "Config.h"
+#include <chrono>
 #include <cmath>
+#include <filesystem>
 #include <iostream>
 #include <fstream> // Nécessaire pour les fichiers
 
-GhostManager::GhostManager(AssetsManager& assets)
+GhostManager::GhostManager(AssetsManager& assets, TextureHandle spriteAtlas)
     : mAssets(assets),
-      mGhostSprite(assets.getTexture("voiture")),
+      mGhostSprite(assets.getTexture(spriteAtlas), assets.getAtlasRegion(Config::SPRITE_CAR)),
       mIsRecording(false), // Faux par défaut, on attend la ligne de départ
       mIsActive(false),
       mHasGhost(false),
@@ -15,14 +17,18 @@ GhostManager::GhostManager(AssetsManager& assets)
       mRecordAccumulator(0.0f)
 {
     mGhostSprite.setScale({Config::CAR_SCALE, Config::CAR_SCALE});
-    sf::Vector2u size = mAssets.getTexture("voiture").getSize();
+    sf::Vector2f size(mGhostSprite.getTextureRect().size);
     mGhostSprite.setOrigin({size.x / 2.f, size.y / 2.f});
 
     // CORRECTION : Couleur Bleue (Cyan) semi-transparente
     mGhostSprite.setColor(sf::Color(0, 255, 255, 120));
 
-    // Chargement du fantôme au démarrage
-    loadGhost();
+    // Chargement du fantôme au démarrage ; celui de l'optimiseur reste à part (affichage de secours)
+    if (loadGhost(Config::GHOST_FILE, mBestGhost)) {
+        mBestTime = mBestGhost.mTotalTime;
+        mHasGhost = true;
+    }
+    loadGhost(Config::REFERENCE_GHOST_FILE, mReferenceGhost);
 }
 
 void GhostManager::update(float dt, const Car& playerCar) {
@@ -44,8 +50,8 @@ void GhostManager::update(float dt, const Car& playerCar) {
     }
 
     // --- LECTURE ---
-    if (mHasGhost && !mBestGhost.isEmpty()) {
-        applyInterpolatedState(mCurrentLapTime);
+    if (const GhostData* ghost = getDisplayedGhost()) {
+        applyInterpolatedState(*ghost, mCurrentLapTime);
     }
 }
 
@@ -62,10 +68,16 @@ void GhostManager::startRecording() {
     // mais elle sera capturée à la frame suivante, ce qui est négligeable (16ms).
 }
 
-void GhostManager::applyInterpolatedState(float time) {
-    if (time >= mBestGhost.mTotalTime) {
-        if (!mBestGhost.mPoints.empty()) {
-            const auto& last = mBestGhost.mPoints.back();
+const GhostData* GhostManager::getDisplayedGhost() const {
+    if (mHasGhost && !mBestGhost.isEmpty()) return &mBestGhost;
+    if (!mReferenceGhost.isEmpty()) return &mReferenceGhost;
+    return nullptr;
+}
+
+void GhostManager::applyInterpolatedState(const GhostData& ghost, float time) {
+    if (time >= ghost.mTotalTime) {
+        if (!ghost.mPoints.empty()) {
+            const auto& last = ghost.mPoints.back();
             mGhostSprite.setPosition(last.position);
             mGhostSprite.setRotation(sf::degrees(last.rotation));
         }
@@ -78,11 +90,11 @@ void GhostManager::applyInterpolatedState(float time) {
     size_t indexA = static_cast<size_t>(exactIndex);
     size_t indexB = indexA + 1;
 
-    if (indexA >= mBestGhost.mPoints.size()) return;
-    if (indexB >= mBestGhost.mPoints.size()) indexB = indexA;
+    if (indexA >= ghost.mPoints.size()) return;
+    if (indexB >= ghost.mPoints.size()) indexB = indexA;
 
-    const auto& pointA = mBestGhost.mPoints[indexA];
-    const auto& pointB = mBestGhost.mPoints[indexB];
+    const auto& pointA = ghost.mPoints[indexA];
+    const auto& pointB = ghost.mPoints[indexB];
 
     float t = exactIndex - static_cast<float>(indexA);
 
@@ -100,16 +112,22 @@ void GhostManager::applyInterpolatedState(float time) {
     mGhostSprite.setRotation(sf::degrees(rot));
 }
 
-void GhostManager::render(sf::RenderWindow& window, bool isPlaying) {
+void GhostManager::render(SpriteBatch& batch, bool isPlaying) const {
     // On n'affiche le fantôme que si la course est active (pas pendant le compte à rebours)
-    if (isPlaying && mHasGhost && mIsActive) {
-        window.draw(mGhostSprite);
+    if (isPlaying && mIsActive && getDisplayedGhost()) {
+        // Même couche et même texture que les voitures : un seul draw call, dessous car soumis en premier
+        batch.draw(mGhostSprite, SpriteBatch::LayerCars);
     }
 }
 
+bool GhostManager::isGhostActive() const { return mIsActive && getDisplayedGhost(); }
+sf::Vector2f GhostManager::getGhostPosition() const { return mGhostSprite.getPosition(); }
+float GhostManager::getGhostRotation() const { return mGhostSprite.getRotation().asDegrees(); }
+
 bool GhostManager::handleLapComplete() {
     float finalLapTime = mCurrentLapTime;
     mCurrentGhost.mTotalTime = finalLapTime;
+    mLastLapSaved = finalLapTime < mBestTime;
 
     if (finalLapTime < mBestTime) {
         std::cout << "New Best Time Ghost! " << finalLapTime << "s" << std::endl;
@@ -139,6 +157,17 @@ float GhostManager::getBestLapTime() const {
     return mBestTime;
 }
 
+std::string GhostManager::saveLastReplay(const std::string& trackId) const {
+    if (!mLastLapSaved) return std::string();
+
+    // Un fichier par entrée, daté à la milliseconde : ghost.dat peut être battu, pas le replay
+    auto stamp = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::string path = Config::REPLAY_PATH + trackId + "_" + std::to_string(stamp) + ".dat";
+    std::error_code ec;
+    std::filesystem::create_directories(Config::REPLAY_PATH, ec);
+    return mBestGhost.saveToFile(path) ? path : std::string();
+}
+
 std::vector<sf::Time> GhostManager::getBestTimes() const {
     if (mBestTime > 9000.0f) return {};
     return { sf::seconds(mBestTime) };
@@ -147,38 +176,64 @@ std::vector<sf::Time> GhostManager::getBestTimes() const {
 // --- PERSISTANCE ---
 
 void GhostManager::saveGhost() {
-    std::ofstream file(GHOST_FILE, std::ios::binary);
-    if (!file) return;
+    if (mBestGhost.saveToFile(Config::GHOST_FILE)) {
+        std::cout << "Ghost saved: " << mBestGhost.mPoints.size() << " points, Time: " << mBestTime << std::endl;
+    }
+}
 
-    // 1. Temps total
-    file.write(reinterpret_cast<const char*>(&mBestTime), sizeof(float));
+bool GhostManager::loadGhost(const std::string& path, GhostData& ghost) {
+    if (!ghost.loadFromFile(path)) return false;
+    std::cout << "Ghost loaded: " << path << ", " << ghost.mTotalTime << "s" << std::endl;
+    return true;
+}
+
+bool GhostData::saveToFile(const std::string& path) const {
+    std::string tempPath = path + ".tmp";
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+    {
+        std::ofstream file(tempPath, std::ios::binary);
+
+        // 1. Temps total
+        file.write(reinterpret_cast<const char*>(&mTotalTime), sizeof(float));
 
-    // 2. Nombre de points
-    size_t count = mBestGhost.mPoints.size();
-    file.write(reinterpret_cast<const char*>(&count), sizeof(size_t));
+        // 2. Nombre de points
+        size_t count = mPoints.size();
+        file.write(reinterpret_cast<const char*>(&count), sizeof(size_t));
 
-    // 3. Les points (Raw Data)
-    if (count > 0) {
-        file.write(reinterpret_cast<const char*>(mBestGhost.mPoints.data()), count * sizeof(GhostPoint));
+        // 3. Les points (Raw Data)
+        if (count > 0) {
+            file.write(reinterpret_cast<const char*>(mPoints.data()), static_cast<std::streamsize>(count * sizeof(GhostPoint)));
+        }
+        file.close();
+        if (!file) {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
     }
-    std::cout << "Ghost saved: " << count << " points, Time: " << mBestTime << std::endl;
+    // Renommage : un fantôme n'est jamais à moitié écrit
+    std::filesystem::rename(tempPath, path, ec);
+    if (!ec) return true;
+    std::filesystem::remove(tempPath, ec);
+    return false;
 }
 
-void GhostManager::loadGhost() {
-    std::ifstream file(GHOST_FILE, std::ios::binary);
-    if (!file) return;
-
-    file.read(reinterpret_cast<char*>(&mBestTime), sizeof(float));
+bool GhostData::loadFromFile(const std::string& path) {
+    reset();
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
 
+    float totalTime = 0.0f;
     size_t count = 0;
+    file.read(reinterpret_cast<char*>(&totalTime), sizeof(float));
     file.read(reinterpret_cast<char*>(&count), sizeof(size_t));
+    if (!file || count > Config::GHOST_MAX_POINTS) return false;
 
-    mBestGhost.mPoints.resize(count);
-    if (count > 0) {
-        file.read(reinterpret_cast<char*>(mBestGhost.mPoints.data()), count * sizeof(GhostPoint));
+    mPoints.resize(count);
+    if (count > 0 && !file.read(reinterpret_cast<char*>(mPoints.data()), static_cast<std::streamsize>(count * sizeof(GhostPoint)))) {
+        reset();
+        return false;
     }
-
-    mBestGhost.mTotalTime = mBestTime;
-    mHasGhost = true;
-    std::cout << "Ghost loaded: " << mBestTime << "s" << std::endl;
-}
\ No newline at end of file
+    mTotalTime = totalTime;
+    return true;
+}
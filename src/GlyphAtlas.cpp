@@ -0,0 +1,73 @@
+#include "GlyphAtlas.h"
+#include <algorithm>
+
+namespace {
+    GlyphAtlas::Glyph convert(const sf::Glyph& glyph) {
+        GlyphAtlas::Glyph out;
+        out.bounds = glyph.bounds;
+        out.texRect = sf::FloatRect(sf::Vector2f(glyph.textureRect.position), sf::Vector2f(glyph.textureRect.size));
+        out.advance = glyph.advance;
+        return out;
+    }
+}
+
+GlyphAtlas::GlyphAtlas(const sf::Font& font, unsigned int characterSize, float outlineThickness)
+    : mFont(font), mCharacterSize(characterSize), mLineSpacing(font.getLineSpacing(characterSize)) {
+    // Tout est rastérisé ici : la page de la police ne bouge plus ensuite
+    for (char c = FIRST_CHAR; c <= LAST_CHAR; ++c) {
+        mFill[index(c)] = convert(font.getGlyph(static_cast<char32_t>(c), characterSize, true));
+        mOutline[index(c)] = convert(font.getGlyph(static_cast<char32_t>(c), characterSize, true, outlineThickness));
+    }
+
+    // Chiffres à chasse fixe : avance commune, glyphe centré dans sa cellule
+    float digitAdvance = 0.f;
+    for (char c = '0'; c <= '9'; ++c) digitAdvance = std::max(digitAdvance, mFill[index(c)].advance);
+    for (char c = '0'; c <= '9'; ++c) {
+        float shift = (digitAdvance - mFill[index(c)].advance) / 2.f;
+        for (Glyph* glyph : {&mFill[index(c)], &mOutline[index(c)]}) {
+            glyph->bounds.position.x += shift;
+            glyph->advance = digitAdvance;
+        }
+    }
+}
+
+std::size_t GlyphAtlas::index(char c) {
+    if (c < FIRST_CHAR || c > LAST_CHAR) c = '?';
+    return static_cast<std::size_t>(c - FIRST_CHAR);
+}
+
+const GlyphAtlas::Glyph& GlyphAtlas::getFill(char c) const { return mFill[index(c)]; }
+const GlyphAtlas::Glyph& GlyphAtlas::getOutline(char c) const { return mOutline[index(c)]; }
+sf::Image GlyphAtlas::copyPage() const {
+    // Seule la zone occupée est copiée : la page de police est bien plus grande
+    sf::Vector2u used(2, 2);
+    for (const auto* glyphs : {&mFill, &mOutline}) {
+        for (const Glyph& glyph : *glyphs) {
+            used.x = std::max(used.x, static_cast<unsigned int>(glyph.texRect.position.x + glyph.texRect.size.x));
+            used.y = std::max(used.y, static_cast<unsigned int>(glyph.texRect.position.y + glyph.texRect.size.y));
+        }
+    }
+
+    sf::Image page = mFont.getTexture(mCharacterSize).copyToImage();
+    sf::Image copy(used);
+    copy.copy(page, {0, 0}, sf::IntRect({0, 0}, sf::Vector2i(used)));
+    return copy;
+}
+
+void GlyphAtlas::relocate(const sf::Texture& texture, sf::Vector2f offset) {
+    for (auto* glyphs : {&mFill, &mOutline}) {
+        for (Glyph& glyph : *glyphs) glyph.texRect.position += offset - mOffset;
+    }
+    mTexture = &texture;
+    mOffset = offset;
+}
+
+const sf::Texture& GlyphAtlas::getTexture() const { return mTexture ? *mTexture : mFont.getTexture(mCharacterSize); }
+
+sf::Vector2f GlyphAtlas::getWhiteTexel() const {
+    // Chaque page de police SFML réserve un carré blanc 2x2 en (0, 0)
+    return mOffset + sf::Vector2f(1.f, 1.f);
+}
+
+unsigned int GlyphAtlas::getCharacterSize() const { return mCharacterSize; }
+float GlyphAtlas::getLineSpacing() const { return mLineSpacing; }
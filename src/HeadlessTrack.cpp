@@ -0,0 +1,62 @@
+#include "HeadlessTrack.h"
+#include "Config.h"
+#include "World.h"
+#include <cmath>
+#include <exception>
+#include <iostream>
+#include <utility>
+
+HeadlessTrack::HeadlessTrack(std::string tool) : mTool(std::move(tool)) {}
+
+bool HeadlessTrack::load(ThreadPool& pool) {
+    // Même choix que le jeu : archive si présente, HD seulement si circuit et masque HD existent
+    mAssets.openArchive(Config::ASSET_ARCHIVE_PATH);
+    World::selectResolution(mAssets);
+    mMaskFilename = World::getMaskFilename(mAssets);
+
+    try {
+        World::decodeCollisionMask(mMask, mAssets, pool);
+    } catch (const std::exception& e) {
+        std::cerr << mTool << ": " << e.what() << std::endl;
+        return false;
+    }
+
+    // Taille de la voiture : fixe la position des pare-chocs testés par Car
+    std::string carPath = Config::TEXTURES_PATH + "voiture.png";
+    if (const PackedAsset* car = mAssets.findPacked(carPath)) {
+        mCarSize = {car->width, car->height};
+    } else {
+        sf::Image image;
+        if (!mAssets.loadImage(carPath, image)) {
+            std::cerr << mTool << ": cannot load " << carPath << std::endl;
+            return false;
+        }
+        mCarSize = image.getSize();
+    }
+
+    // Échelle monde identique à World::finishLoading (circuit et masque de même taille)
+    mScale = static_cast<float>(Config::WINDOW_WIDTH) / static_cast<float>(mMask.getSize().x);
+    mMask.setScale(mScale);
+    return true;
+}
+
+bool HeadlessTrack::loadCenterline(ThreadPool& pool) {
+    float heading = Config::CAR_INITIAL_ROTATION * 3.14159265f / 180.f;
+    if (!mCenterline.load(mMask, mScale, {std::cos(heading), std::sin(heading)}, getCenterlineCachePath(), pool)) {
+        std::cerr << mTool << ": no centerline for " << mMaskFilename << std::endl;
+        return false;
+    }
+    return true;
+}
+
+CollisionMask& HeadlessTrack::getMask() { return mMask; }
+TrackCenterline& HeadlessTrack::getCenterline() { return mCenterline; }
+const std::string& HeadlessTrack::getMaskFilename() const { return mMaskFilename; }
+std::string HeadlessTrack::getCenterlineCachePath() const { return TrackCenterline::cachePathOf(mMaskFilename); }
+sf::Vector2u HeadlessTrack::getCarSize() const { return mCarSize; }
+float HeadlessTrack::getScale() const { return mScale; }
+
+sf::FloatRect HeadlessTrack::getBounds() const {
+    // Même taille que World::mTrackSize : le masque mis à l'échelle de la largeur de fenêtre
+    return sf::FloatRect({0.f, 0.f}, {static_cast<float>(mMask.getSize().x) * mScale, static_cast<float>(mMask.getSize().y) * mScale});
+}
@@ -1,34 +1,55 @@
 #include "Hud.h"
-#include <string>
+#include "Profiler.h"
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
+
+namespace {
+    // Géométrie de l'overlay de performance (pixels écran)
+    constexpr float OVERLAY_X = 10.f;
+    constexpr float OVERLAY_Y = 40.f;
+    constexpr float OVERLAY_HEIGHT = 80.f;
+    constexpr float OVERLAY_MAX_MS = 40.f;   // Valeur au sommet du graphe
+    constexpr std::size_t OVERLAY_BG_QUAD = 0;
+    constexpr std::size_t OVERLAY_LINE_QUAD = 1;  // 2 lignes : 16.6 ms et 33.3 ms
+    constexpr std::size_t OVERLAY_BAR_QUAD = 3;
+    constexpr std::size_t OVERLAY_QUADS = OVERLAY_BAR_QUAD + Profiler::HISTORY_SIZE;
+    constexpr int OVERLAY_TEXT_PERIOD = 15;  // Rafraîchissement du texte toutes les N frames
+
+    // Atlas : une seule taille rastérisée, mise à l'échelle pour chaque texte
+    constexpr unsigned int ATLAS_CHARACTER_SIZE = 64;
+    constexpr float ATLAS_OUTLINE_THICKNESS = 4.f;
+    constexpr float COUNTDOWN_SIZE = 120.f;
+    constexpr float COUNTDOWN_CENTER_RATIO = 0.64f; // Centre vertical des chiffres / taille
+}
 
 /// @brief Constructor
 /// @param font Text font
 HUD::HUD(const sf::Font& font)
-        : mSpeedText(font), mTimerText(font), mCountdownText(font), mFpsText(font) {
-    /// Configure speed text
-    mSpeedText.setCharacterSize(36);
-    mSpeedText.setFillColor(sf::Color::Cyan);
-    mSpeedText.setOutlineColor(sf::Color::Black);
-    mSpeedText.setOutlineThickness(2.f);
-    mSpeedText.setStyle(sf::Text::Bold);
-
-    /// Configure timer text
-    mTimerText.setCharacterSize(28);
-    mTimerText.setFillColor(sf::Color::White);
-    mTimerText.setOutlineColor(sf::Color::Black);
-    mTimerText.setOutlineThickness(2.f);
-    mTimerText.setStyle(sf::Text::Bold);
-
-    /// Configure countdown text
-    mCountdownText.setCharacterSize(120);
-    mCountdownText.setFillColor(sf::Color::Yellow);
-    mCountdownText.setOutlineColor(sf::Color::Black);
-    mCountdownText.setOutlineThickness(5.f);
-    mCountdownText.setStyle(sf::Text::Bold);
-    mFpsText.setFont(font);
-    mFpsText.setCharacterSize(20);
-    mFpsText.setFillColor(sf::Color::Yellow);
-    mFpsText.setPosition({10.f, 10.f});
+        : mAtlas(font, ATLAS_CHARACTER_SIZE, ATLAS_OUTLINE_THICKNESS), mText(mAtlas) {
+    /// Declare every field once: the vertex array never grows afterwards
+    mSpeedField = mText.addField(24, 36.f, sf::Color::Cyan, true, BitmapText::Align::Right);
+    mTimerField = mText.addField(24, 28.f, sf::Color::White, true);
+    mCountdownField = mText.addField(4, COUNTDOWN_SIZE, sf::Color::Yellow, true, BitmapText::Align::Center);
+    for (std::size_t i = 0; i < MAX_BEST_TIMES; ++i) {
+        mBestTimesFields[i] = mText.addField(24, 28.f, sf::Color::White, true, BitmapText::Align::Right);
+        mText.setPosition(mBestTimesFields[i], {1280.f - 20.f, 10.f + i * 30.f});
+    }
+    mFpsField = mText.addField(12, 20.f, sf::Color::Yellow, false, BitmapText::Align::Right);
+
+    /// Configure performance overlay (drawn only when visible)
+    mOverlayFirstVertex = mText.getVertexCount();
+    mOverlayQuad = mText.addQuads(OVERLAY_QUADS);
+    mOverlayField = mText.addField(192, 14.f, sf::Color::White, false);
+    mText.setPosition(mOverlayField, {OVERLAY_X, OVERLAY_Y + OVERLAY_HEIGHT + 4.f});
+
+    float width = static_cast<float>(Profiler::HISTORY_SIZE);
+    mText.setQuad(mOverlayQuad + OVERLAY_BG_QUAD, {OVERLAY_X, OVERLAY_Y}, {width, OVERLAY_HEIGHT}, sf::Color(0, 0, 0, 160));
+    for (std::size_t i = 0; i < 2; ++i) {
+        float budgetMs = 1000.f / 60.f * static_cast<float>(i + 1);
+        float y = OVERLAY_Y + OVERLAY_HEIGHT * (1.f - budgetMs / OVERLAY_MAX_MS);
+        mText.setQuad(mOverlayQuad + OVERLAY_LINE_QUAD + i, {OVERLAY_X, y}, {width, 1.f}, sf::Color(255, 255, 255, 90));
+    }
 }
 
 /// @brief Update HUD texts
@@ -37,83 +58,113 @@ HUD::HUD(const sf::Font& font)
 /// @param countdown Countdown value
 /// @param windowSize Window dimensions
 void HUD::update(float speedKmH, float raceTime, int countdown, sf::Vector2u windowSize) {
+    // Seuls les caractères modifiés ou déplacés sont réécrits dans le vertex array
+    mText.setPosition(mSpeedField, {float(windowSize.x) - 15.f, float(windowSize.y) - 50.f});
     if (std::abs(speedKmH - mLastSpeed) > 0.1f) {
         char speedStr[64];
         snprintf(speedStr, sizeof(speedStr), "Vitesse: %.0f km/h", speedKmH); // %.0f est plus lisible en jeu
-        mSpeedText.setString(speedStr);
+        mText.setText(mSpeedField, speedStr);
         mLastSpeed = speedKmH;
-
-        // Repositionnement uniquement quand le texte change de taille
-        sf::FloatRect speedBounds = mSpeedText.getLocalBounds();
-        mSpeedText.setOrigin({speedBounds.size.x, 0.f});
-        mSpeedText.setPosition({float(windowSize.x) - 15.f, float(windowSize.y) - 50.f});
     }
 
+    mText.setPosition(mCountdownField, {windowSize.x / 2.f, windowSize.y / 2.f - COUNTDOWN_SIZE * COUNTDOWN_CENTER_RATIO});
     if (countdown != mLastCountdown) {
+        char countdownStr[8] = "";
         if (countdown >= 0) {
-            mCountdownText.setString(std::to_string(countdown));
+            snprintf(countdownStr, sizeof(countdownStr), "%d", countdown);
         } else if (countdown == -1) {
-            mCountdownText.setString("GO!");
-        } else {
-            mCountdownText.setString("");
+            snprintf(countdownStr, sizeof(countdownStr), "GO!");
         }
-
-        sf::FloatRect cdBounds = mCountdownText.getLocalBounds();
-        mCountdownText.setOrigin(cdBounds.size / 2.f + cdBounds.position);
-        mCountdownText.setPosition({windowSize.x / 2.f, windowSize.y / 2.f});
-
+        mText.setText(mCountdownField, countdownStr);
         mLastCountdown = countdown;
     }
 
-    if (countdown < 0) {
+    int centiseconds = static_cast<int>(raceTime * 100.f);
+    if (countdown < 0 && centiseconds != mLastCentiseconds) {
         char timeStr[64];
         snprintf(timeStr, sizeof(timeStr), "Temps: %.2f s", raceTime);
-        mTimerText.setString(timeStr);
+        mText.setText(mTimerField, timeStr);
+        mLastCentiseconds = centiseconds;
     }
 }
 
 /// @brief Set best times display
-/// @param times Best race times
+/// @param times Best race times (the first MAX_BEST_TIMES are shown)
 void HUD::setBestTimes(const std::vector<sf::Time>& times) {
-    mBestTimesText.clear();
-
-    for (std::size_t i = 0; i < times.size(); ++i) {
-        sf::Text text = mTimerText;
-        char timeStr[64];
-        snprintf(timeStr, sizeof(timeStr), "Top %zu: %.2f s", i + 1, times[i].asMilliseconds() / 1000.f);
-        text.setString(timeStr);
-
-        /// Position text (top-right)
-        sf::FloatRect bounds = text.getLocalBounds();
-        text.setOrigin({bounds.size.x, 0.f});
-        text.setPosition({1280.f - 20.f, 10.f + i * 30.f});
-        mBestTimesText.push_back(text);
+    for (std::size_t i = 0; i < MAX_BEST_TIMES; ++i) {
+        char timeStr[64] = "";
+        if (i < times.size()) {
+            snprintf(timeStr, sizeof(timeStr), "Top %zu: %.2f s", i + 1, times[i].asMilliseconds() / 1000.f);
+        }
+        mText.setText(mBestTimesFields[i], timeStr);
     }
 }
 
 /// @brief Render HUD
 /// @param window Render target
 void HUD::render(sf::RenderWindow& window) {
-    window.draw(mSpeedText);
-    window.draw(mTimerText);
-    if (!mCountdownText.getString().isEmpty()) {
-        window.draw(mCountdownText);
-    }
-    for (const auto& text : mBestTimesText) {
-        window.draw(text);
-    }
-    window.draw(mFpsText);
+    // Un seul draw call ; l'overlay occupe la fin du tableau
+    mText.draw(window, mShowOverlay ? mText.getVertexCount() : mOverlayFirstVertex);
 }
 
 void HUD::updateFPS(float fps, const sf::Vector2u& windowSize) {
-    // Mise à jour du texte
-    mFpsText.setString("FPS: " + std::to_string(static_cast<int>(fps)));
-
-    // Calcul de la position pour le coin haut-droite
-    // On utilise les bornes locales du texte pour connaître sa largeur réelle
+    // Coin haut-droite : le champ est aligné à droite, pas besoin de mesurer le texte
     float margin = 10.f;
-    float posX = static_cast<float>(windowSize.x) - mFpsText.getLocalBounds().size.x - margin;
-    float posY = margin;
+    mText.setPosition(mFpsField, {static_cast<float>(windowSize.x) - margin, margin});
 
-    mFpsText.setPosition({posX, posY});
-}
\ No newline at end of file
+    char fpsStr[16];
+    snprintf(fpsStr, sizeof(fpsStr), "FPS: %d", static_cast<int>(fps));
+    mText.setText(mFpsField, fpsStr);
+}
+void HUD::toggleOverlay() {
+    mShowOverlay = !mShowOverlay;
+    mOverlayTextCooldown = 0;
+}
+
+bool HUD::isOverlayVisible() const {
+    return mShowOverlay;
+}
+
+const GlyphAtlas& HUD::getGlyphAtlas() const {
+    return mAtlas;
+}
+
+void HUD::useSpriteAtlas(const sf::Texture& texture, const sf::IntRect& glyphRegion) {
+    // Les quads déjà écrits suivent la page : même décalage que le texel blanc
+    sf::Vector2f before = mAtlas.getWhiteTexel();
+    mAtlas.relocate(texture, sf::Vector2f(glyphRegion.position));
+    mText.shiftTexCoords(mAtlas.getWhiteTexel() - before);
+}
+
+void HUD::updateOverlay(std::size_t qualityLevel) {
+    if (!mShowOverlay) return;
+
+    // Barres : de la plus ancienne (gauche) à la plus récente (droite)
+    const auto& history = Profiler::getHistory();
+    std::size_t head = Profiler::getHistoryHead();
+    for (std::size_t i = 0; i < Profiler::HISTORY_SIZE; ++i) {
+        float ms = history[(head + i) % Profiler::HISTORY_SIZE];
+        float h = OVERLAY_HEIGHT * std::min(ms / OVERLAY_MAX_MS, 1.f);
+
+        sf::Color color = sf::Color::Green;
+        if (ms > 1000.f / 30.f) color = sf::Color::Red;
+        else if (ms > 1000.f / 60.f + 1.f) color = sf::Color::Yellow;
+
+        mText.setQuad(mOverlayQuad + OVERLAY_BAR_QUAD + i, {OVERLAY_X + static_cast<float>(i), OVERLAY_Y + OVERLAY_HEIGHT - h}, {1.f, h}, color);
+    }
+
+    // Texte rafraîchi moins souvent pour rester lisible
+    if (--mOverlayTextCooldown > 0) return;
+    mOverlayTextCooldown = OVERLAY_TEXT_PERIOD;
+
+    FrameStats stats = Profiler::getStats();
+    char buffer[256];
+    snprintf(buffer, sizeof(buffer),
+             "frame min %.2f  avg %.2f  p99 %.2f  sd %.2f ms\n"
+             "ticks/frame %u  pacer jitter %.2f ms\n"
+             "draw calls %u  vertices %zu\n"
+             "terrain queries/tick %.1f  quality level %zu",
+             stats.minMs, stats.avgMs, stats.p99Ms, stats.stdDevMs,
+             stats.ticks, stats.jitterMs, stats.drawCalls, stats.vertices, stats.terrainQueriesPerTick, qualityLevel);
+    mText.setText(mOverlayField, buffer);
+}
@@ -0,0 +1,142 @@
+#include "InputManager.h"
+
+InputManager::InputManager()
+    : mState(0), mLatched(0), mQueuedState(0), mQueue{}, mHead(0), mCount(0), mAxisDirection(0), mLatency(nullptr) {}
+
+std::uint32_t InputManager::bit(InputAction action, Source source) {
+    return 1u << (static_cast<unsigned int>(action) * SourceCount + source);
+}
+
+std::uint32_t InputManager::actionMask(InputAction action) {
+    return ((1u << SourceCount) - 1u) << (static_cast<unsigned int>(action) * SourceCount);
+}
+
+void InputManager::handleEvent(const sf::Event& event, Clock::time_point timestamp) {
+    if (const auto* key = event.getIf<sf::Event::KeyPressed>()) {
+        handleKey(key->code, true, timestamp);
+    }
+    else if (const auto* key = event.getIf<sf::Event::KeyReleased>()) {
+        handleKey(key->code, false, timestamp);
+    }
+    else if (const auto* joy = event.getIf<sf::Event::JoystickButtonPressed>()) {
+        if (joy->joystickId == JOYSTICK_ID) handleJoystickButton(joy->button, true, timestamp);
+    }
+    else if (const auto* joy = event.getIf<sf::Event::JoystickButtonReleased>()) {
+        if (joy->joystickId == JOYSTICK_ID) handleJoystickButton(joy->button, false, timestamp);
+    }
+    else if (const auto* joy = event.getIf<sf::Event::JoystickMoved>()) {
+        if (joy->joystickId == JOYSTICK_ID && joy->axis == sf::Joystick::Axis::X) {
+            handleJoystickAxis(joy->position, timestamp);
+        }
+    }
+    else if (const auto* joy = event.getIf<sf::Event::JoystickDisconnected>()) {
+        if (joy->joystickId == JOYSTICK_ID) {
+            // Manette débranchée : on relâche tout ce qu'elle tenait
+            handleJoystickAxis(0.f, timestamp);
+            for (unsigned int button = 0; button < 3; ++button) handleJoystickButton(button, false, timestamp);
+        }
+    }
+}
+
+void InputManager::handleKey(sf::Keyboard::Key key, bool pressed, Clock::time_point timestamp) {
+    // Mapping des touches (ZQSD + flèches)
+    switch (key) {
+        case sf::Keyboard::Key::Z:     push(InputAction::Accelerate, KeyPrimary, pressed, timestamp); break;
+        case sf::Keyboard::Key::S:     push(InputAction::Brake, KeyPrimary, pressed, timestamp); break;
+        case sf::Keyboard::Key::Q:     push(InputAction::TurnLeft, KeyPrimary, pressed, timestamp); break;
+        case sf::Keyboard::Key::D:     push(InputAction::TurnRight, KeyPrimary, pressed, timestamp); break;
+        case sf::Keyboard::Key::Up:    push(InputAction::Accelerate, KeySecondary, pressed, timestamp); break;
+        case sf::Keyboard::Key::Down:  push(InputAction::Brake, KeySecondary, pressed, timestamp); break;
+        case sf::Keyboard::Key::Left:  push(InputAction::TurnLeft, KeySecondary, pressed, timestamp); break;
+        case sf::Keyboard::Key::Right: push(InputAction::TurnRight, KeySecondary, pressed, timestamp); break;
+        default: break;
+    }
+}
+
+void InputManager::handleJoystickButton(unsigned int button, bool pressed, Clock::time_point timestamp) {
+    // Boutons (A = 0, B = 1, X = 2 sur manette Xbox générique)
+    switch (button) {
+        case 0: push(InputAction::Accelerate, JoyButtonA, pressed, timestamp); break;
+        case 1: push(InputAction::Brake, JoyButtonA, pressed, timestamp); break;
+        case 2: push(InputAction::Brake, JoyButtonB, pressed, timestamp); break;
+        default: break;
+    }
+}
+
+void InputManager::handleJoystickAxis(float position, Clock::time_point timestamp) {
+    int direction = 0;
+    if (position < -JOYSTICK_DEADZONE) direction = -1;
+    else if (position > JOYSTICK_DEADZONE) direction = 1;
+
+    // JoystickMoved arrive en rafale : on ne garde que les changements de direction
+    if (direction == mAxisDirection) return;
+    mAxisDirection = direction;
+
+    push(InputAction::TurnLeft, JoyAxis, direction < 0, timestamp);
+    push(InputAction::TurnRight, JoyAxis, direction > 0, timestamp);
+}
+
+void InputManager::push(InputAction action, Source source, bool pressed, Clock::time_point timestamp) {
+    // Répétition automatique ou relâchement d'une source déjà relâchée : rien ne change
+    std::uint32_t b = bit(action, source);
+    if (((mQueuedState & b) != 0) == pressed) return;
+    mQueuedState = pressed ? (mQueuedState | b) : (mQueuedState & ~b);
+
+    // File pleine (longue période sans tick, ex. dans le menu) :
+    // on applique directement la transition la plus ancienne.
+    if (mCount == QUEUE_CAPACITY) {
+        apply(mQueue[mHead]);
+        if (mLatency) mLatency->recordApplied(mQueue[mHead].latencyId);
+        mHead = (mHead + 1) % QUEUE_CAPACITY;
+        mCount--;
+    }
+
+    std::uint32_t latencyId = mLatency ? mLatency->recordInput(timestamp) : 0;
+    mQueue[(mHead + mCount) % QUEUE_CAPACITY] = {timestamp, action, source, pressed, latencyId};
+    mCount++;
+}
+
+void InputManager::apply(const QueuedInput& input) {
+    std::uint32_t b = bit(input.action, input.source);
+    if (input.pressed) {
+        mState |= b;
+        mLatched |= actionMask(input.action);
+    } else {
+        mState &= ~b;
+    }
+}
+
+CarControls InputManager::consumeTick(Clock::time_point tickEnd) {
+    mLatched = 0;
+
+    while (mCount > 0 && mQueue[mHead].timestamp <= tickEnd) {
+        apply(mQueue[mHead]);
+        if (mLatency) mLatency->recordApplied(mQueue[mHead].latencyId);
+        mHead = (mHead + 1) % QUEUE_CAPACITY;
+        mCount--;
+    }
+
+    // Une action est active si une source la tient encore, ou si elle a été
+    // pressée pendant la fenêtre du tick (appui plus court qu'un tick).
+    std::uint32_t active = mState | mLatched;
+
+    CarControls controls;
+    controls.accelerate = (active & actionMask(InputAction::Accelerate)) != 0;
+    controls.brake = (active & actionMask(InputAction::Brake)) != 0;
+    controls.turnLeft = (active & actionMask(InputAction::TurnLeft)) != 0;
+    controls.turnRight = (active & actionMask(InputAction::TurnRight)) != 0;
+    return controls;
+}
+
+void InputManager::reset() {
+    mState = 0;
+    mLatched = 0;
+    mQueuedState = 0;
+    mHead = 0;
+    mCount = 0;
+    mAxisDirection = 0;
+}
+
+void InputManager::setLatencyTracker(LatencyTracker* tracker) {
+    mLatency = tracker;
+}
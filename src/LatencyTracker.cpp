@@ -0,0 +1,101 @@
+#include "LatencyTracker.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <utility>
+
+namespace {
+    constexpr std::size_t RESERVED_SAMPLES = 1 << 16;
+
+    float toMs(LatencyTracker::Clock::duration d) {
+        return std::chrono::duration<float, std::milli>(d).count();
+    }
+
+    void printDistribution(const char* label, std::vector<float> values) {
+        if (values.empty()) return;
+        std::sort(values.begin(), values.end());
+        auto at = [&](float q) { return values[static_cast<std::size_t>(q * (values.size() - 1))]; };
+        std::printf("  %-18s min %6.2f  p50 %6.2f  p95 %6.2f  p99 %6.2f  max %6.2f ms\n",
+                    label, values.front(), at(0.5f), at(0.95f), at(0.99f), values.back());
+    }
+}
+
+LatencyTracker::LatencyTracker(std::string csvPath)
+    : mCsvPath(std::move(csvPath)), mStart(Clock::now()) {
+    mSamples.reserve(RESERVED_SAMPLES);
+    mApplied.reserve(64);
+    mAwaitingPresent.reserve(64);
+}
+
+std::uint32_t LatencyTracker::recordInput(Clock::time_point timestamp) {
+    Sample sample;
+    sample.input = timestamp;
+    mSamples.push_back(sample);
+    return static_cast<std::uint32_t>(mSamples.size() - 1);
+}
+
+void LatencyTracker::recordApplied(std::uint32_t id) {
+    mApplied.push_back(id);
+}
+
+void LatencyTracker::commitTick(std::uint64_t tickIndex, Clock::time_point tickEnd) {
+    Clock::time_point now = Clock::now();
+    for (std::uint32_t id : mApplied) {
+        Sample& s = mSamples[id];
+        s.tick = tickIndex;
+        s.tickEnd = tickEnd;
+        s.tickRun = now;
+        s.consumed = true;
+        mAwaitingPresent.push_back(id);
+    }
+    mApplied.clear();
+}
+
+void LatencyTracker::discardTick() {
+    mApplied.clear();
+}
+
+void LatencyTracker::recordPresent(float alpha) {
+    Clock::time_point now = Clock::now();
+    for (std::uint32_t id : mAwaitingPresent) {
+        Sample& s = mSamples[id];
+        s.present = now;
+        s.alpha = alpha;
+        s.presented = true;
+    }
+    mAwaitingPresent.clear();
+}
+
+void LatencyTracker::report() const {
+    std::vector<float> inputToTick, tickToPresent, inputToPresent;
+
+    std::ofstream csv(mCsvPath);
+    if (csv) {
+        csv << "input_ms,tick,tick_end_ms,tick_run_ms,present_ms,alpha,input_to_tick_ms,tick_to_present_ms,input_to_present_ms\n";
+    }
+
+    for (const Sample& s : mSamples) {
+        if (!s.presented) continue;
+
+        float a = toMs(s.tickRun - s.input);
+        float b = toMs(s.present - s.tickRun);
+        float total = toMs(s.present - s.input);
+        inputToTick.push_back(a);
+        tickToPresent.push_back(b);
+        inputToPresent.push_back(total);
+
+        if (csv) {
+            csv << toMs(s.input - mStart) << ',' << s.tick << ','
+                << toMs(s.tickEnd - mStart) << ',' << toMs(s.tickRun - mStart) << ','
+                << toMs(s.present - mStart) << ',' << s.alpha << ','
+                << a << ',' << b << ',' << total << '\n';
+        }
+    }
+
+    std::cout << "Latency: " << inputToPresent.size() << " inputs presented out of "
+              << mSamples.size() << " recorded (CSV: " << mCsvPath << ")" << std::endl;
+    printDistribution("input -> tick", inputToTick);
+    printDistribution("tick -> present", tickToPresent);
+    printDistribution("input -> present", inputToPresent);
+}
@@ -0,0 +1,38 @@
+#include "LaunchOptions.h"
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+LaunchOptions LaunchOptions::parse(int argc, char* argv[]) {
+    LaunchOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "--uncapped") {
+            options.uncapped = true;
+        } else if (arg == "--bench-particles") {
+            options.benchParticles = true;
+        } else if (arg == "--bench-vecenv") {
+            options.benchVecEnv = true;
+        } else if (arg == "--latency-csv" && i + 1 < argc) {
+            options.latencyCsv = argv[++i];
+        } else if (arg == "--telemetry" && i + 1 < argc) {
+            options.telemetryPath = argv[++i];
+        } else if (arg == "--telemetry-dump" && i + 1 < argc) {
+            options.telemetryDump = argv[++i];
+        } else if (arg == "--ai" && i + 1 < argc) {
+            options.aiDrivers = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--optimize-line" && i + 1 < argc) {
+            options.optimizeGenerations = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--heatmap" && i + 1 < argc) {
+            options.heatmapInputs.push_back(argv[++i]);
+        } else if (arg == "--heatmap-out" && i + 1 < argc) {
+            options.heatmapOutput = argv[++i];
+        } else {
+            std::cerr << "Unknown option ignored: " << arg << std::endl;
+        }
+    }
+
+    return options;
+}
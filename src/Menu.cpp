@@ -1,19 +1,23 @@
 #include "Menu.h"
-#include "ScoreManager.h"
+#include "Config.h"
+#include "Profiler.h"
 #include <cmath>
 #include <iomanip>
 #include <sstream>
 #include <algorithm> // pour std::max
 #include <cstdint>   // pour std::uint8_t
+#include <iostream>
 
 /// @brief Constructor
-Menu::Menu(const sf::Font& font, const sf::Texture& bgTexture)
+Menu::Menu(const sf::Font& font, const Track& track)
         : mFont(font),
-          mBackground(bgTexture), // SFML 3: Sprite doit être init avec une texture
+          mTrack(track),
+          mBackground(track.getPreviewTexture({1u, 1u})), // SFML 3: Sprite doit être init avec une texture
           mTitleText(font),       // SFML 3: Text doit être init avec une font
           mPressStartText(font),
           mResultText(font),
-          mHighScoreTitle(font)
+          mHighScoreTitle(font),
+          mCacheSprite(mCache.getTexture())
 {
     // Configurer le fond (assombri pour lisibilité)
     mBackground.setColor(sf::Color(100, 100, 100));
@@ -44,73 +48,125 @@ Menu::Menu(const sf::Font& font, const sf::Texture& bgTexture)
     mResultText.setFillColor(sf::Color::Green);
     mResultText.setOutlineColor(sf::Color::Black);
     mResultText.setOutlineThickness(3.f);
-
-    updateHighScores();
 }
 
-void Menu::updateHighScores() {
+void Menu::updateHighScores(const std::vector<ScoreEntry>& table) {
     mHighScoresList.clear();
-    std::vector<float> scores = ScoreManager::loadScores();
+    std::size_t shown = std::min(table.size(), Config::MENU_SCORES_SHOWN);
 
-    for (size_t i = 0; i < scores.size(); ++i) {
+    for (size_t i = 0; i < shown; ++i) {
         // SFML 3: Constructeur avec font obligatoire
         sf::Text text(mFont);
         text.setCharacterSize(25);
         text.setFillColor(sf::Color::White);
 
         std::stringstream ss;
-        ss << i + 1 << ". " << std::fixed << std::setprecision(2) << scores[i] << " s";
+        ss << i + 1 << ". " << std::fixed << std::setprecision(2) << table[i].time << " s";
         text.setString(ss.str());
 
         mHighScoresList.push_back(text);
     }
+    mCacheDirty = true;
 }
 
 void Menu::render(sf::RenderWindow& window, bool showResult) {
     sf::Vector2u ws = window.getSize();
 
+    // Recomposition uniquement sur redimensionnement, nouveaux scores ou résultat
+    if (mCacheDirty || ws != mCacheSize || showResult != mCacheShowsResult) {
+        rebuildCache(ws, showResult);
+    }
+
+    if (mCacheValid) {
+        window.draw(mCacheSprite);
+        Profiler::countDrawCall(4);
+    } else {
+        drawStaticLayers(window, showResult);
+    }
+
+    // Faire clignoter "Press Start" : seule la couleur change, pas la géométrie
+    float alpha = (std::sin(mBlinkClock.getElapsedTime().asSeconds() * 5.f) + 1.f) / 2.f; // 0 à 1
+    // SFML 3: sf::Uint8 n'existe plus, utiliser std::uint8_t
+    mPressStartText.setFillColor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(alpha * 255)));
+    window.draw(mPressStartText);
+    Profiler::countText(mPressStartText);
+}
+
+void Menu::layout(sf::Vector2u ws) {
+    // Plus petit niveau LOD couvrant la fenêtre : quelques centaines de Ko au lieu du circuit entier
+    const sf::Texture& bgTexture = mTrack.getPreviewTexture(ws);
+    if (&mBackground.getTexture() != &bgTexture) {
+        mBackground.setTexture(bgTexture, true);
+    }
+
     // SFML 3: getTexture() retourne une référence (const Texture&), donc on utilise '.'
     float scaleX = (float)ws.x / mBackground.getTexture().getSize().x;
     float scaleY = (float)ws.y / mBackground.getTexture().getSize().y;
     mBackground.setScale({std::max(scaleX, scaleY), std::max(scaleX, scaleY)});
-    window.draw(mBackground);
 
     // Centrer le titre
     sf::FloatRect tb = mTitleText.getLocalBounds();
     mTitleText.setOrigin(tb.position + tb.size / 2.f);
     // SFML 3: setPosition attend un sf::Vector2f
     mTitleText.setPosition({ws.x / 2.f, ws.y * 0.2f});
-    window.draw(mTitleText);
-
-    // Faire clignoter "Press Start"
-    float alpha = (std::sin(mBlinkClock.getElapsedTime().asSeconds() * 5.f) + 1.f) / 2.f; // 0 à 1
-    // SFML 3: sf::Uint8 n'existe plus, utiliser std::uint8_t
-    mPressStartText.setFillColor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(alpha * 255)));
 
     sf::FloatRect pb = mPressStartText.getLocalBounds();
     mPressStartText.setOrigin(pb.position + pb.size / 2.f);
     mPressStartText.setPosition({ws.x / 2.f, ws.y * 0.8f});
-    window.draw(mPressStartText);
 
-    // Afficher les High Scores
-    // SFML 3: setPosition attend un sf::Vector2f
+    // High Scores
     mHighScoreTitle.setPosition({ws.x * 0.1f, ws.y * 0.4f});
-    window.draw(mHighScoreTitle);
-
     for (size_t i = 0; i < mHighScoresList.size(); ++i) {
         mHighScoresList[i].setPosition({ws.x * 0.1f, ws.y * 0.45f + i * 35.f});
-        window.draw(mHighScoresList[i]);
     }
 
-    // Afficher le résultat si nécessaire
+    sf::FloatRect rb = mResultText.getLocalBounds();
+    mResultText.setOrigin(rb.position + rb.size / 2.f);
+    mResultText.setPosition({ws.x / 2.f, ws.y * 0.5f});
+}
+
+void Menu::drawStaticLayers(sf::RenderTarget& target, bool showResult) {
+    target.draw(mBackground);
+    Profiler::countDrawCall(4);
+    target.draw(mTitleText);
+    Profiler::countText(mTitleText);
+    target.draw(mHighScoreTitle);
+    Profiler::countText(mHighScoreTitle);
+    for (const auto& text : mHighScoresList) {
+        target.draw(text);
+        Profiler::countText(text);
+    }
     if (showResult) {
-        sf::FloatRect rb = mResultText.getLocalBounds();
-        mResultText.setOrigin(rb.position + rb.size / 2.f);
-        mResultText.setPosition({ws.x / 2.f, ws.y * 0.5f});
-        window.draw(mResultText);
+        target.draw(mResultText);
+        Profiler::countText(mResultText);
     }
 }
 
+void Menu::rebuildCache(sf::Vector2u windowSize, bool showResult) {
+    layout(windowSize);
+
+    if (windowSize != mCacheSize || !mCacheValid) {
+        mCacheValid = mCache.resize(windowSize);
+        if (mCacheValid) {
+            mCacheSprite.setTexture(mCache.getTexture(), true);
+        } else {
+            std::cout << "Menu: render texture unavailable, drawing layers directly" << std::endl;
+        }
+    }
+
+    if (mCacheValid) {
+        mCache.setView(sf::View(sf::FloatRect({0.f, 0.f}, sf::Vector2f(windowSize))));
+        mCache.clear(sf::Color::Black);
+        drawStaticLayers(mCache, showResult);
+        mCache.display();
+    }
+
+    mCacheSize = windowSize;
+    mCacheShowsResult = showResult;
+    mCacheDirty = false;
+}
+
 void Menu::setResultText(const std::string& result) {
     mResultText.setString(result);
-}
\ No newline at end of file
+    mCacheDirty = true;
+}
@@ -0,0 +1,142 @@
+#include "Minimap.h"
+#include "Config.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace {
+    // Priorité du max-pooling : un mur d'un pixel reste visible
+    std::uint8_t priority(TerrainType type) {
+        switch (type) {
+            case TerrainType::WALL:        return 4;
+            case TerrainType::FINISH_LINE: return 3;
+            case TerrainType::CHECKPOINT:  return 2;
+            case TerrainType::ROAD:        return 1;
+            default:                       return 0;
+        }
+    }
+
+    // Couleurs indexées par priorité
+    const sf::Color PALETTE[] = {
+        sf::Color(30, 70, 30, 150),    // Herbe
+        sf::Color(90, 90, 90, 220),    // Route
+        sf::Color(0, 200, 0, 230),     // Checkpoint
+        sf::Color(60, 120, 255, 230),  // Arrivée
+        sf::Color(235, 235, 235, 255)  // Mur
+    };
+}
+
+Minimap::Minimap(const CollisionMask& mask, sf::Vector2f worldSize, ThreadPool& threadPool)
+    : mWorldSize(worldSize) {
+    const std::vector<TerrainType>& grid = mask.getGrid();
+    sf::Vector2u gridSize = mask.getSize();
+
+    unsigned int cell = std::max(1u, (gridSize.x + Config::MINIMAP_WIDTH - 1) / Config::MINIMAP_WIDTH);
+    mMapSize = {(gridSize.x + cell - 1) / cell, (gridSize.y + cell - 1) / cell};
+
+    // Max-pooling en parallèle, une bande de lignes par thread
+    std::vector<std::uint8_t> codes(static_cast<std::size_t>(mMapSize.x) * mMapSize.y, 0);
+    threadPool.parallelFor(mMapSize.y, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t my = begin; my < end; ++my) {
+            unsigned int y0 = static_cast<unsigned int>(my) * cell;
+            unsigned int y1 = std::min(y0 + cell, gridSize.y);
+            for (unsigned int mx = 0; mx < mMapSize.x; ++mx) {
+                unsigned int x0 = mx * cell;
+                unsigned int x1 = std::min(x0 + cell, gridSize.x);
+                std::uint8_t best = 0;
+                for (unsigned int y = y0; y < y1 && best < 4; ++y) {
+                    const TerrainType* row = &grid[static_cast<std::size_t>(y) * gridSize.x];
+                    for (unsigned int x = x0; x < x1; ++x) best = std::max(best, priority(row[x]));
+                }
+                codes[my * mMapSize.x + mx] = best;
+            }
+        }
+    });
+
+    // Image RGBA + une ligne blanche (texel des marqueurs), centres des lignes
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(mMapSize.x) * (mMapSize.y + 1) * 4, 255);
+    sf::Vector2f checkpointSum, finishSum;
+    std::size_t checkpointCount = 0, finishCount = 0;
+    for (unsigned int y = 0; y < mMapSize.y; ++y) {
+        for (unsigned int x = 0; x < mMapSize.x; ++x) {
+            std::size_t i = static_cast<std::size_t>(y) * mMapSize.x + x;
+            const sf::Color& c = PALETTE[codes[i]];
+            pixels[i * 4] = c.r; pixels[i * 4 + 1] = c.g; pixels[i * 4 + 2] = c.b; pixels[i * 4 + 3] = c.a;
+
+            sf::Vector2f center(x + 0.5f, y + 0.5f);
+            if (codes[i] == 2) { checkpointSum += center; ++checkpointCount; }
+            else if (codes[i] == 3) { finishSum += center; ++finishCount; }
+        }
+    }
+    mHasCheckpoint = checkpointCount > 0;
+    mHasFinish = finishCount > 0;
+    if (mHasCheckpoint) mCheckpointCenter = checkpointSum / static_cast<float>(checkpointCount);
+    if (mHasFinish) mFinishCenter = finishSum / static_cast<float>(finishCount);
+
+    if (mTexture.resize({mMapSize.x, mMapSize.y + 1})) {
+        mTexture.update(pixels.data());
+    }
+
+    // Texture fixe : coordonnées du quad de la carte et du texel blanc posées une fois
+    sf::Vector2f whiteTexel(0.5f, mMapSize.y + 0.5f);
+    for (auto& v : mVertices) {
+        v.texCoords = whiteTexel;
+        v.color = sf::Color::Transparent;
+    }
+    float w = static_cast<float>(mMapSize.x), h = static_cast<float>(mMapSize.y);
+    sf::Vector2f tex[6] = {{0.f, 0.f}, {w, 0.f}, {0.f, h}, {0.f, h}, {w, 0.f}, {w, h}};
+    for (std::size_t i = 0; i < 6; ++i) {
+        mVertices[MAP_VERTEX + i].texCoords = tex[i];
+        mVertices[MAP_VERTEX + i].color = sf::Color::White;
+    }
+}
+
+sf::Vector2f Minimap::worldToMap(sf::Vector2f worldPos) const {
+    return {mOrigin.x + worldPos.x / mWorldSize.x * mMapSize.x, mOrigin.y + worldPos.y / mWorldSize.y * mMapSize.y};
+}
+
+void Minimap::render(sf::RenderTarget& target, const MinimapMarkers& markers) {
+    // Coin bas-gauche ; la position ne dépend que de la taille de la cible
+    sf::Vector2f origin(Config::MINIMAP_MARGIN, target.getSize().y - Config::MINIMAP_MARGIN - mMapSize.y);
+    if (origin != mOrigin) {
+        mOrigin = origin;
+        float w = static_cast<float>(mMapSize.x), h = static_cast<float>(mMapSize.y);
+        sf::Vector2f pos[6] = {{0.f, 0.f}, {w, 0.f}, {0.f, h}, {0.f, h}, {w, 0.f}, {w, h}};
+        for (std::size_t i = 0; i < 6; ++i) mVertices[MAP_VERTEX + i].position = mOrigin + pos[i];
+    }
+
+    // Marqueurs : quelques sommets réécrits, carte inchangée
+    if (mHasCheckpoint) {
+        sf::Color color = markers.checkpointPassed ? sf::Color(0, 255, 0, 90) : sf::Color(0, 255, 0);
+        setDiamond(CHECKPOINT_VERTEX, mOrigin + mCheckpointCenter, 4.f, color);
+    }
+    if (mHasFinish) setDiamond(FINISH_VERTEX, mOrigin + mFinishCenter, 4.f, sf::Color(80, 160, 255));
+    setTriangle(GHOST_VERTEX, worldToMap(markers.ghostPosition), markers.ghostRotation,
+                markers.ghostVisible ? sf::Color(255, 255, 255, 150) : sf::Color::Transparent);
+    setTriangle(CAR_VERTEX, worldToMap(markers.carPosition), markers.carRotation, sf::Color::Red);
+
+    target.draw(mVertices.data(), mVertices.size(), sf::PrimitiveType::Triangles, sf::RenderStates(&mTexture));
+    Profiler::countDrawCall(mVertices.size());
+}
+
+void Minimap::setTriangle(std::size_t first, sf::Vector2f center, float rotation, sf::Color color) {
+    float angle = rotation * 3.14159265f / 180.f;
+    sf::Vector2f forward(std::cos(angle), std::sin(angle));
+    sf::Vector2f right(-forward.y, forward.x);
+
+    mVertices[first].position = center + forward * 6.f;
+    mVertices[first + 1].position = center - forward * 4.f + right * 4.f;
+    mVertices[first + 2].position = center - forward * 4.f - right * 4.f;
+    for (std::size_t i = 0; i < 3; ++i) mVertices[first + i].color = color;
+}
+
+void Minimap::setDiamond(std::size_t first, sf::Vector2f center, float radius, sf::Color color) {
+    sf::Vector2f top = center + sf::Vector2f(0.f, -radius), bottom = center + sf::Vector2f(0.f, radius);
+    sf::Vector2f left = center + sf::Vector2f(-radius, 0.f), right = center + sf::Vector2f(radius, 0.f);
+
+    mVertices[first].position = top;     mVertices[first + 1].position = right; mVertices[first + 2].position = left;
+    mVertices[first + 3].position = left; mVertices[first + 4].position = right; mVertices[first + 5].position = bottom;
+    for (std::size_t i = 0; i < 6; ++i) mVertices[first + i].color = color;
+}
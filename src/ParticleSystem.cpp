@@ -0,0 +1,241 @@
+#include "ParticleSystem.h"
+#include "Config.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define RETRORUSH_PARTICLES_SSE 1
+#endif
+
+namespace {
+    struct KindParams {
+        sf::Color color;
+        float size;
+        float growth;   // Croissance de la taille par seconde
+        float life;     // Durée de vie en secondes
+    };
+
+    constexpr KindParams SMOKE_PARAMS = {sf::Color(210, 210, 210, 140), 0.6f, 1.5f, 1.2f};
+    constexpr KindParams GRASS_PARAMS = {sf::Color(70, 150, 40, 220), 0.35f, 0.f, 0.5f};
+
+    const KindParams& paramsOf(ParticleSystem::Kind kind) {
+        return kind == ParticleSystem::Kind::Smoke ? SMOKE_PARAMS : GRASS_PARAMS;
+    }
+}
+
+ParticleSystem::ParticleSystem(std::size_t capacity)
+    : mCapacity(capacity), mLimit(capacity), mAlive(0),
+      mPosX(capacity), mPosY(capacity), mVelX(capacity), mVelY(capacity),
+      mLife(capacity), mInvMaxLife(capacity), mSize(capacity), mGrowth(capacity),
+      mColor(capacity), mVertices(capacity * 6), mRandomState(0x9E3779B9u) {}
+
+float ParticleSystem::random01() {
+    // xorshift32 : suffisant pour de l'aléatoire visuel, sans état global
+    mRandomState ^= mRandomState << 13;
+    mRandomState ^= mRandomState >> 17;
+    mRandomState ^= mRandomState << 5;
+    return static_cast<float>(mRandomState >> 8) * (1.f / 16777216.f);
+}
+
+void ParticleSystem::emit(Kind kind, sf::Vector2f position, sf::Vector2f velocity) {
+    if (mAlive >= mLimit) return;
+
+    const KindParams& params = paramsOf(kind);
+    std::size_t i = mAlive++;
+    mPosX[i] = position.x;
+    mPosY[i] = position.y;
+    mVelX[i] = velocity.x;
+    mVelY[i] = velocity.y;
+    mLife[i] = params.life * (0.75f + 0.5f * random01());
+    mInvMaxLife[i] = 1.f / mLife[i];
+    mSize[i] = params.size;
+    mGrowth[i] = params.growth;
+    mColor[i] = params.color;
+}
+
+void ParticleSystem::emitFromCar(ParticleEmitter& emitter, const Car& car, float dt) {
+    float speed = car.getSpeed();
+    float slip = car.getLateralSlip();
+
+    // Débit proportionnel au dérapage au-delà du seuil, et à l'herbe x vitesse
+    if (slip > Config::DRIFT_SMOKE_SLIP_THRESHOLD) {
+        emitter.smokeAccumulator += (slip - Config::DRIFT_SMOKE_SLIP_THRESHOLD) * Config::PARTICLE_SMOKE_RATE * dt;
+    }
+    if (speed > 1.f) {
+        emitter.grassAccumulator += car.getGrassIntensity() * speed * Config::PARTICLE_GRASS_RATE * dt;
+    }
+    if (emitter.smokeAccumulator < 1.f && emitter.grassAccumulator < 1.f) return;
+
+    // Roues arrière (pour la direction de la gerbe)
+    float angle = car.getRotation() * 3.14159265f / 180.f;
+    sf::Vector2f forward(std::cos(angle), std::sin(angle));
+    sf::Vector2f right(-forward.y, forward.x);
+    std::array<sf::Vector2f, 2> wheels = car.getRearWheelPositions();
+    sf::Vector2f carVelocity = car.getVelocity();
+
+    int wheel = 0;
+    while (emitter.smokeAccumulator >= 1.f) {
+        sf::Vector2f jitter((random01() - 0.5f) * 2.f, (random01() - 0.5f) * 2.f);
+        emit(Kind::Smoke, wheels[wheel], carVelocity * 0.15f + jitter);
+        emitter.smokeAccumulator -= 1.f;
+        wheel ^= 1;
+    }
+    while (emitter.grassAccumulator >= 1.f) {
+        // Gerbe projetée vers l'arrière, ouverte sur les côtés
+        float side = (random01() - 0.5f) * 2.f;
+        sf::Vector2f velocity = -forward * (speed * 0.25f) + right * (side * speed * 0.15f);
+        emit(Kind::Grass, wheels[wheel], carVelocity * 0.3f + velocity);
+        emitter.grassAccumulator -= 1.f;
+        wheel ^= 1;
+    }
+}
+
+void ParticleSystem::update(float dt) {
+    integrate(dt);
+    removeDead();
+}
+
+void ParticleSystem::integrate(float dt) {
+    const float drag = std::exp(-Config::PARTICLE_DRAG * dt);
+    std::size_t i = 0;
+
+#ifdef RETRORUSH_PARTICLES_SSE
+    const __m128 vDt = _mm_set1_ps(dt);
+    const __m128 vDrag = _mm_set1_ps(drag);
+    for (; i + 4 <= mAlive; i += 4) {
+        __m128 vx = _mm_mul_ps(_mm_loadu_ps(&mVelX[i]), vDrag);
+        __m128 vy = _mm_mul_ps(_mm_loadu_ps(&mVelY[i]), vDrag);
+        _mm_storeu_ps(&mVelX[i], vx);
+        _mm_storeu_ps(&mVelY[i], vy);
+        _mm_storeu_ps(&mPosX[i], _mm_add_ps(_mm_loadu_ps(&mPosX[i]), _mm_mul_ps(vx, vDt)));
+        _mm_storeu_ps(&mPosY[i], _mm_add_ps(_mm_loadu_ps(&mPosY[i]), _mm_mul_ps(vy, vDt)));
+        _mm_storeu_ps(&mLife[i], _mm_sub_ps(_mm_loadu_ps(&mLife[i]), vDt));
+        _mm_storeu_ps(&mSize[i], _mm_add_ps(_mm_loadu_ps(&mSize[i]), _mm_mul_ps(_mm_loadu_ps(&mGrowth[i]), vDt)));
+    }
+#endif
+
+    // Reste (ou chemin scalaire sans SSE)
+    for (; i < mAlive; ++i) {
+        mVelX[i] *= drag;
+        mVelY[i] *= drag;
+        mPosX[i] += mVelX[i] * dt;
+        mPosY[i] += mVelY[i] * dt;
+        mLife[i] -= dt;
+        mSize[i] += mGrowth[i] * dt;
+    }
+}
+
+void ParticleSystem::removeDead() {
+    // Swap-remove : le dernier vivant prend la place du mort
+    std::size_t i = 0;
+    while (i < mAlive) {
+        if (mLife[i] > 0.f) { ++i; continue; }
+
+        std::size_t last = --mAlive;
+        mPosX[i] = mPosX[last];
+        mPosY[i] = mPosY[last];
+        mVelX[i] = mVelX[last];
+        mVelY[i] = mVelY[last];
+        mLife[i] = mLife[last];
+        mInvMaxLife[i] = mInvMaxLife[last];
+        mSize[i] = mSize[last];
+        mGrowth[i] = mGrowth[last];
+        mColor[i] = mColor[last];
+    }
+}
+
+void ParticleSystem::buildVertices() {
+    for (std::size_t i = 0; i < mAlive; ++i) {
+        float h = mSize[i] * 0.5f;
+        float x0 = mPosX[i] - h, x1 = mPosX[i] + h;
+        float y0 = mPosY[i] - h, y1 = mPosY[i] + h;
+
+        sf::Color color = mColor[i];
+        color.a = static_cast<std::uint8_t>(color.a * std::clamp(mLife[i] * mInvMaxLife[i], 0.f, 1.f));
+
+        sf::Vertex* v = &mVertices[i * 6];
+        v[0] = {{x0, y0}, color, {}};
+        v[1] = {{x1, y0}, color, {}};
+        v[2] = {{x0, y1}, color, {}};
+        v[3] = {{x0, y1}, color, {}};
+        v[4] = {{x1, y0}, color, {}};
+        v[5] = {{x1, y1}, color, {}};
+    }
+}
+
+void ParticleSystem::render(sf::RenderTarget& target) {
+    if (mAlive == 0) return;
+
+    buildVertices();
+    target.draw(mVertices.data(), mAlive * 6, sf::PrimitiveType::Triangles);
+    Profiler::countDrawCall(mAlive * 6);
+}
+
+void ParticleSystem::clear() {
+    mAlive = 0;
+}
+
+void ParticleSystem::setLimit(std::size_t limit) {
+    // Les particules au-delà de la limite s'éteignent d'elles-mêmes
+    mLimit = std::min(limit, mCapacity);
+}
+
+std::size_t ParticleSystem::getAliveCount() const {
+    return mAlive;
+}
+
+int ParticleSystem::runBenchmark() {
+    using Clock = std::chrono::steady_clock;
+    constexpr std::size_t TARGET_ALIVE = 25000;
+    constexpr int ITERATIONS = 2000;
+    constexpr float DT = Config::TIME_PER_FRAME;
+
+    ParticleSystem system(Config::PARTICLE_CAPACITY);
+    std::vector<double> updateMs, verticesMs;
+    updateMs.reserve(ITERATIONS);
+    verticesMs.reserve(ITERATIONS);
+
+    for (int it = 0; it < ITERATIONS; ++it) {
+        // On maintient la population autour de la cible (comme un drift continu)
+        while (system.getAliveCount() < TARGET_ALIVE) {
+            Kind kind = (system.getAliveCount() & 1) ? Kind::Smoke : Kind::Grass;
+            sf::Vector2f pos(system.random01() * 1280.f, system.random01() * 720.f);
+            sf::Vector2f vel((system.random01() - 0.5f) * 20.f, (system.random01() - 0.5f) * 20.f);
+            system.emit(kind, pos, vel);
+        }
+
+        auto t0 = Clock::now();
+        system.update(DT);
+        auto t1 = Clock::now();
+        system.buildVertices();
+        auto t2 = Clock::now();
+
+        updateMs.push_back(std::chrono::duration<double, std::milli>(t1 - t0).count());
+        verticesMs.push_back(std::chrono::duration<double, std::milli>(t2 - t1).count());
+    }
+
+    auto summarize = [](const char* label, std::vector<double>& samples) {
+        std::sort(samples.begin(), samples.end());
+        double sum = 0.0;
+        for (double s : samples) sum += s;
+        std::printf("  %-10s avg %.3f ms  p50 %.3f ms  p99 %.3f ms\n", label,
+                    sum / samples.size(), samples[samples.size() / 2], samples[samples.size() * 99 / 100]);
+        return sum / samples.size();
+    };
+
+#ifdef RETRORUSH_PARTICLES_SSE
+    const char* path = "SSE";
+#else
+    const char* path = "scalar";
+#endif
+    std::printf("Particle benchmark: ~%zu live particles, %d ticks, %s path\n", TARGET_ALIVE, ITERATIONS, path);
+    double updateAvg = summarize("update", updateMs);
+    double verticesAvg = summarize("vertices", verticesMs);
+    std::printf("  total      avg %.3f ms per tick (budget 1 ms): %s\n", updateAvg + verticesAvg,
+                updateAvg + verticesAvg < 1.0 ? "OK" : "OVER BUDGET");
+    return 0;
+}
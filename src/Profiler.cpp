@@ -0,0 +1,113 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+    std::array<float, Profiler::HISTORY_SIZE> gHistory{};
+    std::size_t gHead = 0;      // Prochain emplacement à écrire (= plus ancien échantillon)
+    std::size_t gSamples = 0;   // Nombre d'échantillons valides
+
+    // Compteurs de la frame en cours
+    unsigned int gFrameTicks = 0;
+    unsigned int gFrameDrawCalls = 0;
+    std::size_t gFrameVertices = 0;
+    std::uint64_t gFrameTerrainQueries = 0;
+    std::uint32_t gTickQueryStart = 0;
+
+    // Début du travail de la frame (après l'attente du pacer)
+    std::chrono::steady_clock::time_point gFrameStart = std::chrono::steady_clock::now();
+
+    // Compteurs de la dernière frame terminée
+    FrameStats gLastFrame;
+}
+
+void Profiler::beginFrame() {
+    gFrameStart = std::chrono::steady_clock::now();
+}
+
+void Profiler::endFrame(sf::Time frameTime, float jitterMs) {
+    gHistory[gHead] = frameTime.asSeconds() * 1000.f;
+    gHead = (gHead + 1) % HISTORY_SIZE;
+    gSamples = std::min(gSamples + 1, HISTORY_SIZE);
+
+    gLastFrame.workMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - gFrameStart).count();
+    gLastFrame.jitterMs = jitterMs;
+    gLastFrame.ticks = gFrameTicks;
+    gLastFrame.drawCalls = gFrameDrawCalls;
+    gLastFrame.vertices = gFrameVertices;
+    gLastFrame.terrainQueriesPerTick = gFrameTicks > 0
+        ? static_cast<float>(gFrameTerrainQueries) / static_cast<float>(gFrameTicks)
+        : 0.f;
+
+    gFrameTicks = 0;
+    gFrameDrawCalls = 0;
+    gFrameVertices = 0;
+    gFrameTerrainQueries = 0;
+}
+
+void Profiler::beginTick() {
+    gTickQueryStart = sTerrainQueries;
+}
+
+void Profiler::endTick() {
+    gFrameTicks++;
+    gFrameTerrainQueries += sTerrainQueries - gTickQueryStart;
+}
+
+void Profiler::countDrawCall(std::size_t vertices) {
+    gFrameDrawCalls++;
+    gFrameVertices += vertices;
+}
+
+void Profiler::countText(const sf::Text& text) {
+    std::size_t glyphs = text.getString().getSize();
+    std::size_t vertices = glyphs * 6;
+    if (text.getOutlineThickness() != 0.f) vertices *= 2;
+    countDrawCall(vertices);
+}
+
+float Profiler::getWorkMs() {
+    return gLastFrame.workMs;
+}
+
+FrameStats Profiler::getStats() {
+    FrameStats stats = gLastFrame;
+    if (gSamples == 0) return stats;
+
+    // Copie sur la pile : pas d'allocation pour le percentile
+    std::array<float, HISTORY_SIZE> sorted;
+    float sum = 0.f;
+    for (std::size_t i = 0; i < gSamples; ++i) {
+        sorted[i] = gHistory[i];
+        sum += gHistory[i];
+    }
+
+    auto end = sorted.begin() + static_cast<std::ptrdiff_t>(gSamples);
+    auto [minIt, maxIt] = std::minmax_element(sorted.begin(), end);
+    stats.minMs = *minIt;
+    stats.maxMs = *maxIt;
+    stats.avgMs = sum / static_cast<float>(gSamples);
+
+    float variance = 0.f;
+    for (std::size_t i = 0; i < gSamples; ++i) {
+        float d = sorted[i] - stats.avgMs;
+        variance += d * d;
+    }
+    stats.stdDevMs = std::sqrt(variance / static_cast<float>(gSamples));
+
+    std::size_t p99Index = (gSamples * 99) / 100;
+    if (p99Index >= gSamples) p99Index = gSamples - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(p99Index), end);
+    stats.p99Ms = sorted[p99Index];
+
+    return stats;
+}
+
+const std::array<float, Profiler::HISTORY_SIZE>& Profiler::getHistory() {
+    return gHistory;
+}
+
+std::size_t Profiler::getHistoryHead() {
+    return gHead;
+}
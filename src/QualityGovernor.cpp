@@ -0,0 +1,47 @@
+#include "QualityGovernor.h"
+#include "Config.h"
+
+// Niveau 0 = qualité maximale ; chaque niveau coupe un peu plus
+const std::array<QualitySettings, QualityGovernor::LEVEL_COUNT> QualityGovernor::LEVELS = {{
+    {1.00f, 1.00f, true, 0},
+    {0.85f, 0.60f, true, 0},
+    {0.70f, 0.35f, true, 1},
+    {0.50f, 0.15f, false, 1},
+}};
+
+QualityGovernor::QualityGovernor(float budgetMs)
+    : mBudgetMs(budgetMs), mAverageMs(0.f), mLevel(0), mOverFrames(0), mUnderFrames(0), mCooldown(0) {}
+
+bool QualityGovernor::update(float workMs) {
+    // Moyenne glissante : un pic isolé ne déclenche rien
+    mAverageMs += (workMs - mAverageMs) * Config::QUALITY_SMOOTHING;
+
+    if (mCooldown > 0) {
+        --mCooldown;
+        return false;
+    }
+
+    mOverFrames = mAverageMs > mBudgetMs * Config::QUALITY_DOWN_RATIO ? mOverFrames + 1 : 0;
+    mUnderFrames = mAverageMs < mBudgetMs * Config::QUALITY_UP_RATIO ? mUnderFrames + 1 : 0;
+
+    std::size_t previous = mLevel;
+    if (mOverFrames >= Config::QUALITY_DOWN_FRAMES && mLevel + 1 < LEVEL_COUNT) {
+        ++mLevel;
+    } else if (mUnderFrames >= Config::QUALITY_UP_FRAMES && mLevel > 0) {
+        --mLevel;
+    }
+    if (mLevel == previous) return false;
+
+    mOverFrames = 0;
+    mUnderFrames = 0;
+    mCooldown = Config::QUALITY_COOLDOWN_FRAMES;
+    return true;
+}
+
+const QualitySettings& QualityGovernor::getSettings() const {
+    return LEVELS[mLevel];
+}
+
+std::size_t QualityGovernor::getLevel() const {
+    return mLevel;
+}
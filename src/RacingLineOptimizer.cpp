@@ -0,0 +1,263 @@
+#include "RacingLineOptimizer.h"
+#include "HeadlessTrack.h"
+#include "Config.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    bool isOffTrack(TerrainType type) {
+        return type == TerrainType::WALL || type == TerrainType::GRASS;
+    }
+}
+
+RacingLineOptimizer::RacingLineOptimizer(const CollisionMask& mask, const TrackCenterline& centerline, sf::IntRect carRect, sf::FloatRect bounds, ThreadPool& pool)
+    : mMask(mask), mCenterline(centerline), mCarRect(carRect), mBounds(bounds), mPool(pool), mRandom(Config::OPT_SEED) {
+    measureWidths();
+}
+
+void RacingLineOptimizer::measureWidths() {
+    // Un nœud tous les OPT_KNOT_SPACING, bornes mesurées le long de la normale
+    std::size_t knotCount = std::max<std::size_t>(8, static_cast<std::size_t>(mCenterline.getLength() / Config::OPT_KNOT_SPACING));
+    float halfWidth = mCarRect.size.y * Config::CAR_SCALE / 2.f + Config::OPT_EDGE_MARGIN;
+    float knotSpacing = mCenterline.getLength() / static_cast<float>(knotCount);
+
+    mMinOffset.resize(knotCount);
+    mMaxOffset.resize(knotCount);
+    for (std::size_t k = 0; k < knotCount; ++k) {
+        sf::Vector2f center = mCenterline.positionAt(k * knotSpacing);
+        sf::Vector2f tangent = mCenterline.tangentAt(k * knotSpacing);
+        sf::Vector2f right(-tangent.y, tangent.x);
+
+        auto reach = [&](float side) {
+            float distance = 0.f;
+            while (distance < Config::OPT_MAX_HALF_WIDTH &&
+                   !isOffTrack(mMask.getTerrain(center + right * (side * (distance + Config::OPT_WIDTH_STEP))))) {
+                distance += Config::OPT_WIDTH_STEP;
+            }
+            return distance;
+        };
+        mMinOffset[k] = std::min(0.f, halfWidth - reach(-1.f));
+        mMaxOffset[k] = std::max(0.f, reach(1.f) - halfWidth);
+    }
+}
+
+RacingLineOptimizer::Candidate RacingLineOptimizer::randomCandidate() {
+    Candidate candidate;
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+    candidate.knots.resize(mMinOffset.size());
+    for (std::size_t k = 0; k < candidate.knots.size(); ++k) {
+        // Tirage resserré autour du centre : les lignes extrêmes finissent dans l'herbe
+        float t = 0.5f + (unit(mRandom) - 0.5f) * 0.6f;
+        candidate.knots[k] = mMinOffset[k] + (mMaxOffset[k] - mMinOffset[k]) * t;
+    }
+    candidate.cornerMargin = Config::OPT_MARGIN_MIN + (Config::OPT_MARGIN_MAX - Config::OPT_MARGIN_MIN) * unit(mRandom);
+    return candidate;
+}
+
+RacingLineOptimizer::Candidate RacingLineOptimizer::breed(const Candidate& a, const Candidate& b, float scale) {
+    const std::size_t count = a.knots.size();
+    std::uniform_int_distribution<std::size_t> cut(0, count - 1);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+    std::normal_distribution<float> gauss(0.f, 1.f);
+
+    // Croisement en deux points sur la boucle : des portions de circuit entières passent d'un parent à l'autre
+    Candidate child = a;
+    std::size_t first = cut(mRandom);
+    std::size_t length = cut(mRandom);
+    for (std::size_t n = 0; n < length; ++n) {
+        std::size_t k = (first + n) % count;
+        child.knots[k] = b.knots[k];
+    }
+    if (unit(mRandom) < 0.5f) child.cornerMargin = b.cornerMargin;
+
+    // Mutation gaussienne proportionnelle à la largeur disponible
+    for (std::size_t k = 0; k < count; ++k) {
+        if (unit(mRandom) >= Config::OPT_MUTATION_RATE) continue;
+        float range = mMaxOffset[k] - mMinOffset[k];
+        child.knots[k] = std::clamp(child.knots[k] + gauss(mRandom) * range * scale, mMinOffset[k], mMaxOffset[k]);
+    }
+    float marginRange = Config::OPT_MARGIN_MAX - Config::OPT_MARGIN_MIN;
+    child.cornerMargin = std::clamp(child.cornerMargin + gauss(mRandom) * marginRange * scale * 0.5f,
+                                    Config::OPT_MARGIN_MIN, Config::OPT_MARGIN_MAX);
+    child.evaluated = false;
+    return child;
+}
+
+void RacingLineOptimizer::simulate(AIDrivers& driver, Candidate& candidate, std::vector<GhostPoint>* poses) const {
+    driver.setRacingLine(mCenterline, mCenterline.expandKnots(candidate.knots), candidate.cornerMargin);
+    driver.place(0, {Config::CAR_INITIAL_POS_X, Config::CAR_INITIAL_POS_Y}, Config::CAR_INITIAL_ROTATION);
+
+    const sf::Time dt = sf::seconds(Config::TIME_PER_FRAME);
+    const long lineSize = static_cast<long>(driver.getLineSize());
+    const long maxTicks = static_cast<long>(Config::OPT_MAX_LAP_TIME * Config::PHYSICS_FPS);
+    const long stallTicks = static_cast<long>(Config::OPT_STALL_TIME * Config::PHYSICS_FPS);
+
+    // Progression en échantillons de ligne, comme le suivi de l'IA
+    long progress = 0, bestProgress = 0, sinceBest = 0;
+    long lapTicks = 0, grassTicks = 0;
+    std::uint32_t lastIndex = driver.getLineIndex(0);
+    bool timing = false, finished = false;
+
+    for (long tick = 0; tick < maxTicks; ++tick) {
+        driver.update(dt, mBounds, mMask);
+        const Car& car = driver.getCar(0);
+
+        long delta = static_cast<long>(driver.getLineIndex(0)) - static_cast<long>(lastIndex);
+        if (delta > lineSize / 2) delta -= lineSize;
+        if (delta < -lineSize / 2) delta += lineSize;
+        lastIndex = driver.getLineIndex(0);
+        progress += delta;
+
+        // Chrono lancé sur la ligne d'arrivée, comme pour le joueur
+        bool onFinish = mMask.isOnBlue(car.getPosition());
+        if (!timing) {
+            if (onFinish) {
+                timing = true;
+                progress = bestProgress = sinceBest = 0;
+            }
+        } else {
+            lapTicks++;
+            if (mMask.isOnGrass(car.getPosition())) grassTicks++;
+            if (poses) poses->push_back({car.getPosition(), car.getRotation()});
+            if (onFinish && progress > lineSize * 9 / 10) {
+                finished = true;
+                break;
+            }
+        }
+
+        // Voiture bloquée (mur, tête-à-queue) : inutile d'attendre la fin du temps
+        if (progress > bestProgress) { bestProgress = progress; sinceBest = 0; }
+        else if (++sinceBest > stallTicks) break;
+    }
+
+    candidate.evaluated = true;
+    candidate.lapTime = lapTicks * Config::TIME_PER_FRAME;
+    if (finished) {
+        candidate.fitness = candidate.lapTime + Config::OPT_GRASS_PENALTY * grassTicks * Config::TIME_PER_FRAME;
+    } else {
+        // Tour non bouclé : classé après tous les tours finis, par distance parcourue
+        float done = std::clamp(static_cast<float>(bestProgress) / static_cast<float>(lineSize), 0.f, 1.f);
+        candidate.fitness = Config::OPT_MAX_LAP_TIME * (2.f - done);
+        if (poses) poses->clear();
+    }
+}
+
+void RacingLineOptimizer::evaluate(std::vector<Candidate>& population) {
+    std::vector<Candidate*> pending;
+    for (Candidate& candidate : population) {
+        if (!candidate.evaluated) pending.push_back(&candidate);
+    }
+
+    // Un pilote (et sa texture vide) par tranche : aucun état partagé entre threads
+    mPool.parallelFor(pending.size(), [&](std::size_t begin, std::size_t end) {
+        sf::Texture texture;
+        AIDrivers driver(texture, mCarRect);
+        driver.setRacingLine(mCenterline);
+        driver.spawn(1, 0.f);
+        for (std::size_t i = begin; i < end; ++i) simulate(driver, *pending[i], nullptr);
+    });
+    mLaps += pending.size();
+}
+
+TrackCenterline::RacingLine RacingLineOptimizer::run(std::size_t generations) {
+    // Population initiale : ligne centrale, ligne en cache, puis tirages aléatoires
+    std::vector<Candidate> population;
+    Candidate center;
+    center.knots.assign(mMinOffset.size(), 0.f);
+    center.cornerMargin = Config::AI_TURN_MARGIN;
+    population.push_back(center);
+    if (mCenterline.hasRacingLine()) {
+        TrackCenterline::RacingLine cached = mCenterline.getRacingLine();
+        if (cached.knots.size() == mMinOffset.size()) {
+            Candidate previous;
+            previous.knots = cached.knots;
+            previous.cornerMargin = cached.cornerMargin;
+            population.push_back(previous);
+        }
+    }
+    while (population.size() < Config::OPT_POPULATION) population.push_back(randomCandidate());
+
+    auto byFitness = [](const Candidate& a, const Candidate& b) { return a.fitness < b.fitness; };
+    sf::Clock clock;
+    for (std::size_t generation = 0; generation < generations; ++generation) {
+        evaluate(population);
+        std::sort(population.begin(), population.end(), byFitness);
+
+        float seconds = std::max(clock.getElapsedTime().asSeconds(), 1e-3f);
+        std::cout << "Generation " << generation + 1 << "/" << generations << ": best " << population[0].fitness
+                  << " s (lap " << population[0].lapTime << " s, margin " << population[0].cornerMargin << "), "
+                  << static_cast<std::uint64_t>(mLaps / seconds) << " laps/s" << std::endl;
+
+        // Élites conservées telles quelles (déjà évaluées), le reste est reproduit à partir d'elles
+        float scale = Config::OPT_MUTATION_SCALE * (1.f - 0.8f * static_cast<float>(generation) / static_cast<float>(generations));
+        std::uniform_int_distribution<std::size_t> parent(0, std::min(Config::OPT_ELITE, population.size()) - 1);
+        for (std::size_t i = Config::OPT_ELITE; i < population.size(); ++i) {
+            const Candidate& a = population[parent(mRandom)];
+            const Candidate& b = population[parent(mRandom)];
+            population[i] = breed(a, b, scale);
+        }
+    }
+
+    evaluate(population);
+    std::sort(population.begin(), population.end(), byFitness);
+    TrackCenterline::RacingLine best;
+    best.knots = population[0].knots;
+    best.cornerMargin = population[0].cornerMargin;
+    best.lapTime = population[0].lapTime;
+    return best;
+}
+
+std::vector<GhostPoint> RacingLineOptimizer::recordLap(const TrackCenterline::RacingLine& line) const {
+    sf::Texture texture;
+    AIDrivers driver(texture, mCarRect);
+    driver.setRacingLine(mCenterline);
+    driver.spawn(1, 0.f);
+
+    Candidate candidate;
+    candidate.knots = line.knots;
+    candidate.cornerMargin = line.cornerMargin;
+    std::vector<GhostPoint> poses;
+    simulate(driver, candidate, &poses);
+    return poses;
+}
+
+int RacingLineOptimizer::runTool(std::size_t generations) {
+    ThreadPool threadPool;
+    HeadlessTrack track("Optimizer");
+    if (!track.load(threadPool) || !track.loadCenterline(threadPool)) return 1;
+    CollisionMask& mask = track.getMask();
+    TrackCenterline& centerline = track.getCenterline();
+    const std::string& maskFilename = track.getMaskFilename();
+    std::string cachePath = track.getCenterlineCachePath();
+
+    RacingLineOptimizer optimizer(mask, centerline, sf::IntRect({0, 0}, sf::Vector2i(track.getCarSize())), track.getBounds(), threadPool);
+    std::cout << "Optimizing " << maskFilename << ": " << optimizer.mMinOffset.size() << " knots, population "
+              << Config::OPT_POPULATION << ", " << threadPool.getThreadCount() + 1 << " threads" << std::endl;
+    TrackCenterline::RacingLine best = optimizer.run(generations);
+
+    std::vector<GhostPoint> poses = optimizer.recordLap(best);
+    if (poses.empty()) {
+        std::cerr << "Optimizer: no candidate finished a lap, cache left unchanged" << std::endl;
+        return 1;
+    }
+
+    // Ligne écrite avec le cache de la ligne centrale : relue par World pour les adversaires
+    centerline.setRacingLine(best);
+    if (!centerline.save(cachePath)) {
+        std::cerr << "Optimizer: cannot write " << cachePath << std::endl;
+        return 1;
+    }
+    std::cout << "Racing line written to " << cachePath << " (lap " << best.lapTime << " s)" << std::endl;
+
+    // Fantôme de référence, au format de ghost.dat, rangé avec les sauvegardes
+    GhostData reference;
+    reference.mPoints = std::move(poses);
+    reference.mTotalTime = best.lapTime;
+    if (!reference.saveToFile(Config::REFERENCE_GHOST_FILE)) {
+        std::cerr << "Optimizer: cannot write " << Config::REFERENCE_GHOST_FILE << std::endl;
+        return 1;
+    }
+    std::cout << "Reference ghost written to " << Config::REFERENCE_GHOST_FILE << std::endl;
+    return 0;
+}
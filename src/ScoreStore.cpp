@@ -0,0 +1,209 @@
+#include "ScoreStore.h"
+#include "Config.h"
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    constexpr const char* SNAPSHOT_MAGIC = "RRSCORES";
+    constexpr int SNAPSHOT_VERSION = 1;
+
+    // Plus rapide d'abord, puis le plus ancien à temps égal
+    bool faster(const ScoreEntry& a, const ScoreEntry& b) {
+        return a.time != b.time ? a.time < b.time : a.sequence < b.sequence;
+    }
+}
+
+ScoreStore::ScoreStore(std::string snapshotPath, std::string logPath, std::size_t capacity)
+    : mSnapshotPath(std::move(snapshotPath)), mLogPath(std::move(logPath)), mCapacity(std::max<std::size_t>(capacity, 1)),
+      mWriter([this]() { writerLoop(); }) {}
+
+ScoreStore::~ScoreStore() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWake.notify_one();
+    mWriter.join();
+}
+
+void ScoreStore::load(const std::string& legacyTrack) {
+    std::uint64_t snapshotSequence = 0;
+    std::size_t loaded = 0;
+
+    std::ifstream snapshot(mSnapshotPath);
+    std::string line;
+    if (snapshot && std::getline(snapshot, line)) {
+        std::istringstream header(line);
+        std::string magic;
+        int version = 0;
+        header >> magic >> version >> snapshotSequence;
+
+        if (magic == SNAPSHOT_MAGIC && version == SNAPSHOT_VERSION) {
+            std::string track;
+            ScoreEntry entry;
+            while (std::getline(snapshot, line)) {
+                if (parseRecord(line, track, entry)) loaded += insert(track, entry) >= 0;
+            }
+        } else {
+            // Ancien format : un temps par ligne, sans piste ni replay
+            snapshot.clear();
+            snapshot.seekg(0);
+            float time;
+            while (snapshot >> time) {
+                loaded += insert(legacyTrack, ScoreEntry{time, mNextSequence, ""}) >= 0;
+            }
+            snapshotSequence = 0;
+        }
+    }
+
+    // Journal : seuls les enregistrements postérieurs au snapshot sont rejoués
+    // (crash entre le renommage et la troncature du journal)
+    std::size_t replayed = 0;
+    std::ifstream log(mLogPath);
+    std::string track;
+    ScoreEntry entry;
+    while (std::getline(log, line)) {
+        // Dernière ligne tronquée par un crash : ignorée
+        if (!parseRecord(line, track, entry) || entry.sequence <= snapshotSequence) continue;
+        insert(track, entry);
+        replayed++;
+    }
+
+    std::cout << "Scores: " << loaded << " entries, " << replayed << " replayed from log" << std::endl;
+
+    // Journal non vide ou ancien format : on repart d'un snapshot propre
+    if (replayed > 0 || (loaded > 0 && snapshotSequence == 0)) {
+        enqueue(Job{true, {}, {}, formatTables(), mNextSequence - 1});
+    }
+}
+
+int ScoreStore::insert(const std::string& track, ScoreEntry entry) {
+    std::vector<ScoreEntry>& table = mTables[track];
+    if (table.capacity() < mCapacity) table.reserve(mCapacity);
+    mNextSequence = std::max(mNextSequence, entry.sequence + 1);
+
+    // Recherche dichotomique ; une table pleine rejette les temps plus lents que son dernier
+    auto it = std::upper_bound(table.begin(), table.end(), entry, faster);
+    if (it == table.end() && table.size() >= mCapacity) return -1;
+
+    // Décalage des entrées plus lentes : O(n) déplacements, borné par la capacité (réservée, sans réallocation)
+    int rank = static_cast<int>(it - table.begin());
+    if (table.size() >= mCapacity) table.pop_back();
+    table.insert(table.begin() + rank, std::move(entry));
+    return rank;
+}
+
+int ScoreStore::submit(const std::string& track, float time, const std::string& replay) {
+    ScoreEntry entry{time, mNextSequence, replay};
+    int rank = insert(track, entry);
+    if (rank < 0) return -1;
+
+    enqueue(Job{false, track, entry, {}, 0});
+
+    // Compactage périodique : le snapshot est formaté ici, écrit par le thread d'écriture
+    if (++mAppendsSinceCompaction >= Config::SCORE_COMPACT_INTERVAL) {
+        mAppendsSinceCompaction = 0;
+        enqueue(Job{true, {}, {}, formatTables(), mNextSequence - 1});
+    }
+    return rank;
+}
+
+const std::vector<ScoreEntry>& ScoreStore::getTable(const std::string& track) const {
+    static const std::vector<ScoreEntry> empty;
+    auto it = mTables.find(track);
+    return it != mTables.end() ? it->second : empty;
+}
+
+void ScoreStore::flush() {
+    std::unique_lock<std::mutex> lock(mMutex);
+    mIdle.wait(lock, [this]() { return mJobs.empty() && !mWriting; });
+}
+
+std::string ScoreStore::formatTables() const {
+    std::string out;
+    for (const auto& [track, table] : mTables) {
+        for (const ScoreEntry& entry : table) out += formatRecord(track, entry);
+    }
+    return out;
+}
+
+std::string ScoreStore::formatRecord(const std::string& track, const ScoreEntry& entry) {
+    std::ostringstream line;
+    line << track << ' ' << entry.sequence << ' ' << std::setprecision(9) << entry.time << ' '
+         << (entry.replay.empty() ? "-" : entry.replay) << '\n';
+    return line.str();
+}
+
+bool ScoreStore::parseRecord(const std::string& line, std::string& track, ScoreEntry& entry) const {
+    std::istringstream fields(line);
+    std::string replay;
+    if (!(fields >> track >> entry.sequence >> entry.time >> replay)) return false;
+    entry.replay = replay == "-" ? "" : replay;
+    return true;
+}
+
+void ScoreStore::enqueue(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJobs.push_back(std::move(job));
+    }
+    mWake.notify_one();
+}
+
+void ScoreStore::writerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWake.wait(lock, [this]() { return mStopping || !mJobs.empty(); });
+            // La file est vidée avant l'arrêt : aucun score ne se perd à la fermeture
+            if (mJobs.empty()) return;
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+            mWriting = true;
+        }
+
+        write(job);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mWriting = false;
+        }
+        mIdle.notify_all();
+    }
+}
+
+void ScoreStore::write(const Job& job) {
+    if (!job.compact) {
+        if (!mLog.is_open()) mLog.open(mLogPath, std::ios::app);
+        mLog << formatRecord(job.track, job.entry);
+        mLog.flush();
+        if (!mLog) std::cout << "Failed to append score to " << mLogPath << std::endl;
+        return;
+    }
+
+    // Snapshot complet dans un fichier temporaire, puis renommage atomique
+    std::string temporary = mSnapshotPath + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::trunc);
+        out << SNAPSHOT_MAGIC << ' ' << SNAPSHOT_VERSION << ' ' << job.lastSequence << '\n' << job.snapshot;
+        out.flush();
+        if (!out) {
+            std::cout << "Failed to write " << temporary << std::endl;
+            return;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temporary, mSnapshotPath, ec);
+    if (ec) {
+        std::cout << "Failed to replace " << mSnapshotPath << ": " << ec.message() << std::endl;
+        return;
+    }
+
+    // Tout le journal est dans le snapshot : on le vide
+    mLog.close();
+    mLog.open(mLogPath, std::ios::trunc);
+}
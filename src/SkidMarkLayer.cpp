@@ -0,0 +1,172 @@
+#include "SkidMarkLayer.h"
+#include "Config.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Les tuiles stockent une couleur prémultipliée par l'alpha :
+    // composition "One, OneMinusSrcAlpha" à l'affichage.
+    const sf::BlendMode BLEND_PREMULTIPLIED(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+
+    // Atténuation : pas constant soustrait de la destination (couleur et alpha), borné à zéro.
+    // Contrairement à un facteur multiplicatif sur 8 bits, les faibles opacités finissent bien à zéro.
+    const sf::BlendMode BLEND_FADE(sf::BlendMode::Factor::One, sf::BlendMode::Factor::One, sf::BlendMode::Equation::ReverseSubtract);
+
+    // Passages nécessaires pour vider une tuile saturée
+    constexpr unsigned int FADES_TO_CLEAR = (255 + Config::SKID_FADE_STEP - 1) / Config::SKID_FADE_STEP;
+}
+
+SkidMarkLayer::SkidMarkLayer(sf::Vector2f worldSize)
+    : mWorldSize(worldSize),
+      mTileWorldSize(static_cast<float>(Config::SKID_TILE_SIZE) / Config::SKID_TEXELS_PER_UNIT)
+{
+    mTileCount = {static_cast<unsigned int>(std::ceil(worldSize.x / mTileWorldSize)),
+                  static_cast<unsigned int>(std::ceil(worldSize.y / mTileWorldSize))};
+    mTiles.resize(static_cast<std::size_t>(mTileCount.x) * mTileCount.y);
+}
+
+void SkidMarkLayer::stampFromCar(SkidTrail& trail, const Car& car) {
+    std::array<sf::Vector2f, 2> wheels = car.getRearWheelPositions();
+
+    bool sliding = car.getLateralSlip() > Config::SKID_SLIP_THRESHOLD;
+    if (sliding && trail.active) {
+        stampSegment(trail.lastWheels[0], wheels[0]);
+        stampSegment(trail.lastWheels[1], wheels[1]);
+    }
+
+    trail.lastWheels = wheels;
+    trail.active = sliding;
+}
+
+void SkidMarkLayer::stampSegment(sf::Vector2f from, sf::Vector2f to) {
+    sf::Vector2f dir = to - from;
+    float length = std::sqrt(dir.x * dir.x + dir.y * dir.y);
+    if (length < 0.0001f) return;
+
+    sf::Vector2f normal(-dir.y / length * Config::SKID_MARK_WIDTH * 0.5f, dir.x / length * Config::SKID_MARK_WIDTH * 0.5f);
+    const sf::Color color(20, 20, 20, Config::SKID_MARK_ALPHA);
+    sf::Vertex quad[6] = {
+        {from + normal, color, {}}, {to + normal, color, {}}, {from - normal, color, {}},
+        {from - normal, color, {}}, {to + normal, color, {}}, {to - normal, color, {}},
+    };
+
+    // Ajout dans chaque tuile recouverte (4 au plus) : rectangle sale = tuile
+    float minX = std::min(from.x, to.x) - Config::SKID_MARK_WIDTH, maxX = std::max(from.x, to.x) + Config::SKID_MARK_WIDTH;
+    float minY = std::min(from.y, to.y) - Config::SKID_MARK_WIDTH, maxY = std::max(from.y, to.y) + Config::SKID_MARK_WIDTH;
+    if (maxX < 0.f || maxY < 0.f || minX >= mWorldSize.x || minY >= mWorldSize.y) return;
+
+    auto toTile = [this](float v, unsigned int count) {
+        return static_cast<unsigned int>(std::clamp(static_cast<int>(v / mTileWorldSize), 0, static_cast<int>(count) - 1));
+    };
+    for (unsigned int ty = toTile(minY, mTileCount.y); ty <= toTile(maxY, mTileCount.y); ++ty) {
+        for (unsigned int tx = toTile(minX, mTileCount.x); tx <= toTile(maxX, mTileCount.x); ++tx) {
+            Tile& tile = tileAt(tx, ty);
+            if (tile.pending.empty() && !tile.fadePending) mDirtyTiles.push_back(ty * mTileCount.x + tx);
+            tile.pending.insert(tile.pending.end(), std::begin(quad), std::end(quad));
+            tile.fadesLeft = FADES_TO_CLEAR;
+        }
+    }
+}
+
+SkidMarkLayer::Tile& SkidMarkLayer::tileAt(unsigned int tx, unsigned int ty) {
+    Tile& tile = mTiles[static_cast<std::size_t>(ty) * mTileCount.x + tx];
+    if (!tile.texture) {
+        tile.texture = std::make_unique<sf::RenderTexture>();
+        if (tile.texture->resize({Config::SKID_TILE_SIZE, Config::SKID_TILE_SIZE})) {
+            tile.texture->setSmooth(true);
+            tile.texture->clear(sf::Color::Transparent);
+            tile.texture->setView(sf::View(tileWorldRect(tx, ty)));
+        }
+    }
+    return tile;
+}
+
+sf::FloatRect SkidMarkLayer::tileWorldRect(unsigned int tx, unsigned int ty) const {
+    return sf::FloatRect({tx * mTileWorldSize, ty * mTileWorldSize}, {mTileWorldSize, mTileWorldSize});
+}
+
+void SkidMarkLayer::update(float dt) {
+    // Chaque tuile marquée suit son propre calendrier : même durée de vie des traces quel que soit le nombre de tuiles
+    for (std::size_t index = 0; index < mTiles.size(); ++index) {
+        Tile& tile = mTiles[index];
+        if (tile.fadesLeft == 0) continue;
+
+        tile.fadeTimer += dt;
+        if (tile.fadeTimer < Config::SKID_FADE_INTERVAL) continue;
+        tile.fadeTimer -= Config::SKID_FADE_INTERVAL;
+
+        // Plus rien à estomper une fois la tuile vidée : elle n'est plus redessinée
+        tile.fadesLeft--;
+        if (tile.pending.empty() && !tile.fadePending) mDirtyTiles.push_back(index);
+        tile.fadePending = true;
+    }
+}
+
+void SkidMarkLayer::flush() {
+    // Seules les tuiles modifiées depuis la dernière frame sont redessinées
+    for (std::size_t index : mDirtyTiles) {
+        Tile& tile = mTiles[index];
+        sf::RenderTexture& texture = *tile.texture;
+
+        if (tile.fadePending) {
+            sf::FloatRect rect = tileWorldRect(static_cast<unsigned int>(index % mTileCount.x),
+                                               static_cast<unsigned int>(index / mTileCount.x));
+            sf::Vector2f p0 = rect.position, p1 = rect.position + rect.size;
+            const sf::Color fade(Config::SKID_FADE_STEP, Config::SKID_FADE_STEP, Config::SKID_FADE_STEP, Config::SKID_FADE_STEP);
+            sf::Vertex quad[6] = {
+                {{p0.x, p0.y}, fade, {}}, {{p1.x, p0.y}, fade, {}}, {{p0.x, p1.y}, fade, {}},
+                {{p0.x, p1.y}, fade, {}}, {{p1.x, p0.y}, fade, {}}, {{p1.x, p1.y}, fade, {}},
+            };
+            texture.draw(quad, 6, sf::PrimitiveType::Triangles, sf::RenderStates(BLEND_FADE));
+            tile.fadePending = false;
+        }
+        if (!tile.pending.empty()) {
+            texture.draw(tile.pending.data(), tile.pending.size(), sf::PrimitiveType::Triangles);
+            tile.pending.clear();
+        }
+        texture.display();
+    }
+    mDirtyTiles.clear();
+}
+
+void SkidMarkLayer::render(sf::RenderTarget& target, const sf::FloatRect& viewRect) {
+    flush();
+
+    sf::RenderStates states(BLEND_PREMULTIPLIED);
+    for (unsigned int ty = 0; ty < mTileCount.y; ++ty) {
+        for (unsigned int tx = 0; tx < mTileCount.x; ++tx) {
+            const Tile& tile = mTiles[static_cast<std::size_t>(ty) * mTileCount.x + tx];
+            if (!tile.texture) continue;
+
+            sf::FloatRect rect = tileWorldRect(tx, ty);
+            if (!rect.findIntersection(viewRect)) continue;
+
+            // Un quad texturé par tuile, quel que soit le nombre de traces
+            sf::Vector2f p0 = rect.position, p1 = rect.position + rect.size;
+            float t = static_cast<float>(Config::SKID_TILE_SIZE);
+            sf::Vertex quad[6] = {
+                {{p0.x, p0.y}, sf::Color::White, {0.f, 0.f}}, {{p1.x, p0.y}, sf::Color::White, {t, 0.f}},
+                {{p0.x, p1.y}, sf::Color::White, {0.f, t}},   {{p0.x, p1.y}, sf::Color::White, {0.f, t}},
+                {{p1.x, p0.y}, sf::Color::White, {t, 0.f}},   {{p1.x, p1.y}, sf::Color::White, {t, t}},
+            };
+            states.texture = &tile.texture->getTexture();
+            target.draw(quad, 6, sf::PrimitiveType::Triangles, states);
+            Profiler::countDrawCall(6);
+        }
+    }
+}
+
+void SkidMarkLayer::clear() {
+    for (Tile& tile : mTiles) {
+        tile.pending.clear();
+        tile.fadePending = false;
+        tile.fadeTimer = 0.f;
+        tile.fadesLeft = 0;
+        if (tile.texture) {
+            tile.texture->clear(sf::Color::Transparent);
+            tile.texture->display();
+        }
+    }
+    mDirtyTiles.clear();
+}
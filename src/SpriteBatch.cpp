@@ -0,0 +1,84 @@
+#include "SpriteBatch.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <functional>
+
+SpriteBatch::SpriteBatch() : mVertices(sf::PrimitiveType::Triangles) {
+    mQuads.reserve(256);
+    mBlendModes.reserve(4);
+}
+
+std::uint8_t SpriteBatch::blendIndex(const sf::BlendMode& blendMode) {
+    for (std::size_t i = 0; i < mBlendModes.size(); ++i) {
+        if (mBlendModes[i] == blendMode) return static_cast<std::uint8_t>(i);
+    }
+    mBlendModes.push_back(blendMode);
+    return static_cast<std::uint8_t>(mBlendModes.size() - 1);
+}
+
+void SpriteBatch::draw(const sf::Texture& texture, const sf::IntRect& textureRect, const sf::Transform& transform,
+                       sf::Color color, std::uint8_t layer, const sf::BlendMode& blendMode) {
+    Quad quad;
+    // Tri : couche, puis mode de blend, puis ordre de soumission (la texture est
+    // départagée dans flush() pour garder un tri stable sans hacher le pointeur)
+    quad.key = (static_cast<std::uint64_t>(layer) << 56)
+             | (static_cast<std::uint64_t>(blendIndex(blendMode)) << 48)
+             | static_cast<std::uint64_t>(mQuads.size());
+    quad.texture = &texture;
+
+    sf::Vector2f size(textureRect.size);
+    sf::Vector2f uv0(textureRect.position);
+    sf::Vector2f uv1 = uv0 + size;
+
+    sf::Vector2f p00 = transform.transformPoint({0.f, 0.f});
+    sf::Vector2f p10 = transform.transformPoint({size.x, 0.f});
+    sf::Vector2f p01 = transform.transformPoint({0.f, size.y});
+    sf::Vector2f p11 = transform.transformPoint(size);
+
+    quad.vertices[0] = {p00, color, {uv0.x, uv0.y}};
+    quad.vertices[1] = {p10, color, {uv1.x, uv0.y}};
+    quad.vertices[2] = {p01, color, {uv0.x, uv1.y}};
+    quad.vertices[3] = {p01, color, {uv0.x, uv1.y}};
+    quad.vertices[4] = {p10, color, {uv1.x, uv0.y}};
+    quad.vertices[5] = {p11, color, {uv1.x, uv1.y}};
+
+    mQuads.push_back(quad);
+}
+
+void SpriteBatch::draw(const sf::Sprite& sprite, std::uint8_t layer) {
+    draw(sprite.getTexture(), sprite.getTextureRect(), sprite.getTransform(), sprite.getColor(), layer);
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target) {
+    if (mQuads.empty()) return;
+
+    // Regroupement par (couche, blend, texture) en gardant l'ordre de soumission
+    std::stable_sort(mQuads.begin(), mQuads.end(), [](const Quad& a, const Quad& b) {
+        std::uint64_t groupA = a.key >> 48;
+        std::uint64_t groupB = b.key >> 48;
+        if (groupA != groupB) return groupA < groupB;
+        return std::less<const sf::Texture*>()(a.texture, b.texture);
+    });
+
+    std::size_t begin = 0;
+    while (begin < mQuads.size()) {
+        std::size_t end = begin;
+        std::uint64_t group = mQuads[begin].key >> 48;
+        const sf::Texture* texture = mQuads[begin].texture;
+
+        mVertices.clear();
+        while (end < mQuads.size() && (mQuads[end].key >> 48) == group && mQuads[end].texture == texture) {
+            for (const sf::Vertex& v : mQuads[end].vertices) mVertices.append(v);
+            ++end;
+        }
+
+        sf::RenderStates states(mBlendModes[(group & 0xFF)]);
+        states.texture = texture;
+        target.draw(mVertices, states);
+        Profiler::countDrawCall(mVertices.getVertexCount());
+
+        begin = end;
+    }
+
+    mQuads.clear();
+}
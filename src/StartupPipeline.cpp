@@ -0,0 +1,131 @@
+#include "StartupPipeline.h"
+#include <cstdio>
+#include <exception>
+#include <iostream>
+
+StartupPipeline::StartupPipeline(ThreadPool& pool) : mPool(pool), mDone(0), mStart(Clock::now()), mCancelled(false) {}
+
+StartupPipeline::~StartupPipeline() {
+    for (Task& task : mTasks) {
+        if (task.state == State::Running && task.result.valid()) task.result.wait();
+    }
+}
+
+StartupPipeline::TaskId StartupPipeline::addTask(std::string name, Thread thread, std::vector<TaskId> dependencies,
+                                                 std::function<Status()> work) {
+    Task task;
+    task.name = std::move(name);
+    task.thread = thread;
+    task.dependencies = std::move(dependencies);
+    task.work = std::move(work);
+    mTasks.push_back(std::move(task));
+    return mTasks.size() - 1;
+}
+
+bool StartupPipeline::isReady(const Task& task) const {
+    if (task.state != State::Waiting) return false;
+    for (TaskId dependency : task.dependencies) {
+        if (mTasks[dependency].state != State::Done) return false;
+    }
+    return true;
+}
+
+void StartupPipeline::finish(Task& task, Status status, const std::string& error) {
+    if (task.thread == Thread::Main || status == Status::Failed) task.end = Clock::now();
+    if (status == Status::Failed) {
+        task.state = State::Failed;
+        if (mError.empty()) mError = error.empty() ? "Failed to load " + task.name : error;
+    } else {
+        task.state = State::Done;
+        mDone++;
+    }
+}
+
+void StartupPipeline::poll() {
+    // Plus rien ne démarre après un échec ou une annulation ; les workers en vol sont seulement collectés
+    bool stopped = !mError.empty() || mCancelled;
+
+    // 1. Résultats des workers
+    for (Task& task : mTasks) {
+        if (task.state != State::Running || task.thread != Thread::Worker) continue;
+        if (task.result.wait_for(std::chrono::seconds(0)) != std::future_status::ready) continue;
+        try {
+            finish(task, task.result.get());
+        } catch (const std::exception& e) {
+            finish(task, Status::Failed, e.what());
+        }
+    }
+
+    if (stopped) return;
+
+    // 2. Lancement des tâches prêtes ; celles du thread principal s'exécutent en lot ici
+    for (std::size_t i = 0; i < mTasks.size() && mError.empty(); ++i) {
+        Task& task = mTasks[i];
+        bool again = task.state == State::Running && task.thread == Thread::Main;
+        if (!again && !isReady(task)) continue;
+
+        if (!again) {
+            task.state = State::Running;
+            task.start = Clock::now();
+            mCurrentLabel = task.name;
+        }
+
+        if (task.thread == Thread::Worker) {
+            // mTasks n'est plus redimensionné une fois le pipeline lancé : la référence reste valide
+            task.result = mPool.submit([&task]() {
+                Status status = task.work();
+                task.end = Clock::now();
+                return status;
+            });
+            continue;
+        }
+
+        try {
+            Status status = task.work();
+            if (status != Status::Again) finish(task, status);
+        } catch (const std::exception& e) {
+            finish(task, Status::Failed, e.what());
+        }
+    }
+}
+
+void StartupPipeline::cancel() {
+    mCancelled = true;
+}
+
+bool StartupPipeline::isFinished() const {
+    bool stopped = !mError.empty() || mCancelled;
+    for (const Task& task : mTasks) {
+        if (task.state == State::Running && (task.thread == Thread::Worker || !stopped)) return false;
+        if (!stopped && task.state == State::Waiting) return false;
+    }
+    return true;
+}
+
+bool StartupPipeline::hasFailed() const {
+    return !mError.empty();
+}
+
+const std::string& StartupPipeline::getError() const {
+    return mError;
+}
+
+float StartupPipeline::getProgress() const {
+    return mTasks.empty() ? 1.f : static_cast<float>(mDone) / static_cast<float>(mTasks.size());
+}
+
+const std::string& StartupPipeline::getCurrentLabel() const {
+    return mCurrentLabel;
+}
+
+void StartupPipeline::printTimings() const {
+    auto toMs = [this](Clock::time_point t) { return std::chrono::duration<float, std::milli>(t - mStart).count(); };
+
+    std::cout << "Startup tasks:" << std::endl;
+    for (const Task& task : mTasks) {
+        if (task.state != State::Done) continue;
+        std::printf("  %-22s %-6s %7.1f -> %7.1f ms (%6.1f ms)\n", task.name.c_str(),
+                    task.thread == Thread::Worker ? "worker" : "main",
+                    toMs(task.start), toMs(task.end), toMs(task.end) - toMs(task.start));
+    }
+}
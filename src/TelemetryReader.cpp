@@ -0,0 +1,146 @@
+#include "TelemetryReader.h"
+#include "Config.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+using namespace TelemetryFormat;
+
+bool TelemetryReader::open(const std::string& path) {
+    mChunks.clear();
+    mTickCount = 0;
+    if (!mFile.open(path)) return false;
+
+    const std::uint8_t* data = mFile.data();
+    const std::uint8_t* end = data + mFile.size();
+    Header header;
+    if (mFile.size() < sizeof(header)) return false;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(header.magic)) != 0 || header.columnCount != ColumnCount) return false;
+
+    // Index des blocs : seuls les en-têtes sont lus, les colonnes restent dans le mapping
+    const std::uint8_t* cursor = data + sizeof(header);
+    while (static_cast<std::size_t>(end - cursor) >= sizeof(ChunkHeader)) {
+        ChunkHeader chunkHeader;
+        std::memcpy(&chunkHeader, cursor, sizeof(chunkHeader));
+        if (chunkHeader.magic != CHUNK_MAGIC) break;
+
+        // En-tête corrompu : jamais plus de lignes qu'un bloc du recorder, ni qu'un octet par valeur
+        if (chunkHeader.rowCount > Config::TELEMETRY_CHUNK_TICKS) break;
+
+        Chunk chunk;
+        chunk.firstTick = chunkHeader.firstTick;
+        chunk.rows = chunkHeader.rowCount;
+        const std::uint8_t* column = cursor + sizeof(chunkHeader);
+        bool complete = true;
+        for (std::uint32_t c = 0; c < ColumnCount; ++c) {
+            if (chunkHeader.columnBytes[c] > static_cast<std::size_t>(end - column) ||
+                chunkHeader.rowCount > chunkHeader.columnBytes[c]) {
+                complete = false; // Dernier bloc tronqué (crash pendant l'écriture) ou incohérent
+                break;
+            }
+            chunk.columns[c] = column;
+            chunk.columnBytes[c] = chunkHeader.columnBytes[c];
+            column += chunkHeader.columnBytes[c];
+        }
+        if (!complete) break;
+
+        mChunks.push_back(chunk);
+        mTickCount += chunk.rows;
+        cursor = column;
+    }
+    return true;
+}
+
+const std::vector<TelemetryReader::Chunk>& TelemetryReader::getChunks() const {
+    return mChunks;
+}
+
+std::uint64_t TelemetryReader::getTickCount() const {
+    return mTickCount;
+}
+
+bool TelemetryReader::decode(std::size_t chunkIndex, Column column, std::vector<std::uint32_t>& out) const {
+    const Chunk& chunk = mChunks[chunkIndex];
+    const std::uint8_t* data = chunk.columns[column];
+    const std::uint8_t* end = data + chunk.columnBytes[column];
+    bool isFloat = column < FIRST_INTEGER_COLUMN;
+
+    out.resize(chunk.rows);
+    std::uint32_t previous = 0;
+    for (std::uint32_t row = 0; row < chunk.rows; ++row) {
+        std::uint32_t raw;
+        if (!readVarint(data, end, raw)) return false;
+        previous = isFloat ? raw ^ previous : previous + static_cast<std::uint32_t>(unzigzag(raw));
+        out[row] = previous;
+    }
+    return true;
+}
+
+bool TelemetryReader::readFloats(std::size_t chunk, Column column, std::vector<float>& out) const {
+    // Bits décodés dans un tampon de travail, puis réinterprétés en flottants
+    static_assert(sizeof(float) == sizeof(std::uint32_t));
+    thread_local std::vector<std::uint32_t> bits;
+    if (column >= FIRST_INTEGER_COLUMN || !decode(chunk, column, bits)) return false;
+    out.resize(bits.size());
+    if (!bits.empty()) std::memcpy(out.data(), bits.data(), bits.size() * sizeof(float));
+    return true;
+}
+
+bool TelemetryReader::readIntegers(std::size_t chunk, Column column, std::vector<std::uint32_t>& out) const {
+    if (column < FIRST_INTEGER_COLUMN) return false;
+    return decode(chunk, column, out);
+}
+
+int TelemetryReader::dump(const std::string& path) {
+    TelemetryReader reader;
+    if (!reader.open(path)) {
+        std::cerr << "Cannot read telemetry file " << path << std::endl;
+        return 1;
+    }
+
+    const char* names[ColumnCount] = {"position x", "position y", "velocity x", "velocity y", "heading", "steer", "grass", "terrain", "inputs"};
+    std::uint64_t columnBytes[ColumnCount] = {};
+    double sum[ColumnCount] = {};
+    double minimum[ColumnCount];
+    double maximum[ColumnCount];
+    std::fill(std::begin(minimum), std::end(minimum), std::numeric_limits<double>::max());
+    std::fill(std::begin(maximum), std::end(maximum), std::numeric_limits<double>::lowest());
+
+    // Colonne par colonne, bloc par bloc : un seul tampon réutilisé
+    std::vector<float> floats;
+    std::vector<std::uint32_t> integers;
+    for (std::size_t chunk = 0; chunk < reader.getChunks().size(); ++chunk) {
+        for (std::uint32_t c = 0; c < ColumnCount; ++c) {
+            Column column = static_cast<Column>(c);
+            columnBytes[c] += reader.getChunks()[chunk].columnBytes[c];
+            auto accumulate = [&](double value) {
+                sum[c] += value;
+                minimum[c] = std::min(minimum[c], value);
+                maximum[c] = std::max(maximum[c], value);
+            };
+            if (c < FIRST_INTEGER_COLUMN) {
+                if (!reader.readFloats(chunk, column, floats)) continue;
+                for (float value : floats) accumulate(value);
+            } else {
+                if (!reader.readIntegers(chunk, column, integers)) continue;
+                for (std::uint32_t value : integers) accumulate(value);
+            }
+        }
+    }
+
+    std::uint64_t ticks = reader.getTickCount();
+    std::cout << path << ": " << reader.getChunks().size() << " chunks, " << ticks << " ticks" << std::endl;
+    if (ticks == 0) return 0;
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (std::uint32_t c = 0; c < ColumnCount; ++c) {
+        std::cout << "  " << std::left << std::setw(12) << names[c] << std::right
+                  << " min " << std::setw(10) << minimum[c] << "  max " << std::setw(10) << maximum[c]
+                  << "  mean " << std::setw(10) << sum[c] / static_cast<double>(ticks)
+                  << "  " << static_cast<double>(columnBytes[c]) / static_cast<double>(ticks) << " B/tick" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include "TelemetryRecorder.h"
+#include "Config.h"
+#include <cstring>
+#include <iostream>
+
+using namespace TelemetryFormat;
+
+namespace {
+    std::uint32_t floatBits(float value) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+}
+
+TelemetryRecorder::TelemetryRecorder(std::string path)
+    : mPath(std::move(path)), mFile(mPath, std::ios::binary | std::ios::trunc),
+      mWriter([this]() { writerLoop(); }) {
+    // Tous les tampons sont alloués ici : record() n'alloue jamais
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (std::size_t i = 0; i < Config::TELEMETRY_CHUNK_BUFFERS; ++i) {
+            auto chunk = std::make_unique<Chunk>();
+            for (auto& column : chunk->columns) column.resize(Config::TELEMETRY_CHUNK_TICKS);
+            mFree.push_back(chunk.get());
+            mChunks.push_back(std::move(chunk));
+        }
+        mCurrent = mFree.back();
+        mFree.pop_back();
+        mEncoded.reserve(Config::TELEMETRY_CHUNK_TICKS * ColumnCount * 5 + sizeof(ChunkHeader));
+
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+        header.columnCount = ColumnCount;
+        mFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        mOpen = static_cast<bool>(mFile);
+    }
+    if (!mOpen) std::cout << "Telemetry: cannot write " << mPath << std::endl;
+}
+
+TelemetryRecorder::~TelemetryRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mCurrent && mCurrent->rows > 0) mFull.push_back(mCurrent);
+        mCurrent = nullptr;
+        mStopping = true;
+    }
+    mWake.notify_one();
+    mWriter.join();
+
+    std::cout << "Telemetry: " << mRecorded << " ticks, " << mBytesWritten / 1024 << " KB written to " << mPath;
+    if (mDropped > 0) std::cout << ", " << mDropped << " ticks dropped";
+    std::cout << std::endl;
+}
+
+bool TelemetryRecorder::isOpen() const {
+    // mFile appartient au thread d'écriture : résultat de l'ouverture mémorisé à la construction
+    return mOpen;
+}
+
+void TelemetryRecorder::record(std::uint64_t tick, const TelemetrySample& sample) {
+    if (!mCurrent) return;
+    Chunk& chunk = *mCurrent;
+    if (chunk.rows == 0) chunk.firstTick = tick;
+
+    // Une écriture par colonne : pas d'encodage sur le thread principal
+    std::uint32_t row = chunk.rows++;
+    chunk.columns[PositionX][row] = floatBits(sample.position[0]);
+    chunk.columns[PositionY][row] = floatBits(sample.position[1]);
+    chunk.columns[VelocityX][row] = floatBits(sample.velocity[0]);
+    chunk.columns[VelocityY][row] = floatBits(sample.velocity[1]);
+    chunk.columns[Heading][row] = floatBits(sample.heading);
+    chunk.columns[Steer][row] = floatBits(sample.steer);
+    chunk.columns[Grass][row] = floatBits(sample.grass);
+    chunk.columns[Terrain][row] = sample.terrain;
+    chunk.columns[Inputs][row] = sample.inputs;
+    mRecorded++;
+
+    if (chunk.rows == Config::TELEMETRY_CHUNK_TICKS) submit();
+}
+
+void TelemetryRecorder::submit() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mFree.empty()) {
+            // Écriture en retard : le bloc est perdu, le tick n'attend pas
+            mDropped += mCurrent->rows;
+            mCurrent->rows = 0;
+            return;
+        }
+        mFull.push_back(mCurrent);
+        mCurrent = mFree.back();
+        mFree.pop_back();
+        mCurrent->rows = 0;
+    }
+    mWake.notify_one();
+}
+
+void TelemetryRecorder::writerLoop() {
+    while (true) {
+        Chunk* chunk = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWake.wait(lock, [this]() { return mStopping || !mFull.empty(); });
+            // Les blocs pleins sont écrits avant l'arrêt
+            if (mFull.empty()) return;
+            chunk = mFull.front();
+            mFull.erase(mFull.begin());
+        }
+
+        encode(*chunk);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mFree.push_back(chunk);
+    }
+}
+
+void TelemetryRecorder::encode(const Chunk& chunk) {
+    ChunkHeader header{};
+    header.magic = CHUNK_MAGIC;
+    header.rowCount = chunk.rows;
+    header.firstTick = chunk.firstTick;
+
+    mEncoded.assign(sizeof(header), 0);
+    for (std::uint32_t c = 0; c < ColumnCount; ++c) {
+        std::size_t start = mEncoded.size();
+        const std::vector<std::uint32_t>& values = chunk.columns[c];
+        std::uint32_t previous = 0;
+
+        if (c < FIRST_INTEGER_COLUMN) {
+            // Flottants voisins : mêmes bits de poids fort, XOR court
+            for (std::uint32_t row = 0; row < chunk.rows; ++row) {
+                appendVarint(mEncoded, values[row] ^ previous);
+                previous = values[row];
+            }
+        } else {
+            // Entiers : écart au précédent, presque toujours nul
+            for (std::uint32_t row = 0; row < chunk.rows; ++row) {
+                appendVarint(mEncoded, zigzag(static_cast<std::int32_t>(values[row] - previous)));
+                previous = values[row];
+            }
+        }
+        header.columnBytes[c] = static_cast<std::uint32_t>(mEncoded.size() - start);
+    }
+    std::memcpy(mEncoded.data(), &header, sizeof(header));
+
+    mFile.write(reinterpret_cast<const char*>(mEncoded.data()), static_cast<std::streamsize>(mEncoded.size()));
+    mFile.flush();
+    mBytesWritten += mEncoded.size();
+}
@@ -0,0 +1,168 @@
+#include "TextureAtlas.h"
+#include "Config.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace {
+    unsigned int nextPowerOfTwo(unsigned int value) {
+        unsigned int result = 1;
+        while (result < value) result <<= 1;
+        return result;
+    }
+}
+
+TextureAtlas::TextureAtlas(unsigned int maxSize) : mMaxSize(maxSize) {}
+
+void TextureAtlas::add(const std::string& name, const std::uint8_t* pixels, sf::Vector2u size) {
+    if (!pixels || size.x == 0 || size.y == 0) return;
+    auto it = std::find_if(mSources.begin(), mSources.end(), [&](const Source& s) { return s.name == name; });
+    Source& source = it != mSources.end() ? *it : mSources.emplace_back();
+    source.name = name;
+    source.size = size;
+    source.pixels.assign(pixels, pixels + std::size_t(size.x) * size.y * 4);
+}
+
+bool TextureAtlas::pack() {
+    // Plus hautes d'abord : la ligne d'horizon reste plate, peu de place perdue
+    std::sort(mSources.begin(), mSources.end(), [](const Source& a, const Source& b) {
+        return a.size.y != b.size.y ? a.size.y > b.size.y : a.size.x > b.size.x;
+    });
+
+    unsigned int padding = 2 * Config::ATLAS_PADDING;
+    unsigned int widest = 0;
+    std::size_t area = 0;
+    for (const Source& source : mSources) {
+        widest = std::max(widest, source.size.x + padding);
+        area += std::size_t(source.size.x + padding) * (source.size.y + padding);
+    }
+
+    // Plus petit carré (puis rectangle 2:1) en puissance de deux qui contient tout
+    unsigned int side = nextPowerOfTwo(std::max(widest, 1u));
+    while (std::size_t(side) * side < area) side <<= 1;
+    for (; side <= mMaxSize; side <<= 1) {
+        for (sf::Vector2u size : {sf::Vector2u(side, side / 2), sf::Vector2u(side, side)}) {
+            if (size.y == 0 || std::size_t(size.x) * size.y < area || !tryPack(size)) continue;
+
+            mSize = size;
+            mPixels.assign(std::size_t(size.x) * size.y * 4, 0);
+            for (const Source& source : mSources) {
+                blit(source, sf::Vector2u(mRegions[source.name].position) - sf::Vector2u(Config::ATLAS_PADDING, Config::ATLAS_PADDING));
+            }
+            std::cout << "Texture atlas: " << mSources.size() << " images in " << size.x << "x" << size.y << std::endl;
+            return true;
+        }
+    }
+    std::cout << "Texture atlas: images do not fit in " << mMaxSize << "x" << mMaxSize << std::endl;
+    return false;
+}
+
+bool TextureAtlas::tryPack(sf::Vector2u atlasSize) {
+    mRegions.clear();
+    mSkyline.assign(1, SkylineNode{0, 0, atlasSize.x});
+
+    unsigned int padding = 2 * Config::ATLAS_PADDING;
+    for (const Source& source : mSources) {
+        unsigned int width = source.size.x + padding;
+        unsigned int height = source.size.y + padding;
+        std::size_t node;
+        unsigned int y;
+        if (!findPosition(width, height, atlasSize.y, node, y)) return false;
+
+        unsigned int x = mSkyline[node].x;
+        insertNode(node, x, y + height, width);
+        mRegions[source.name] = sf::IntRect(
+            {static_cast<int>(x + Config::ATLAS_PADDING), static_cast<int>(y + Config::ATLAS_PADDING)},
+            {static_cast<int>(source.size.x), static_cast<int>(source.size.y)});
+    }
+    return true;
+}
+
+bool TextureAtlas::findPosition(unsigned int width, unsigned int height, unsigned int atlasHeight,
+                                std::size_t& bestNode, unsigned int& bestY) const {
+    // Bottom-left : position la plus basse, puis la plus à gauche
+    bool found = false;
+    for (std::size_t i = 0; i < mSkyline.size(); ++i) {
+        if (mSkyline[i].x + width > mSkyline.back().x + mSkyline.back().width) break;
+
+        // Hauteur de pose = sommet des segments couverts par la largeur
+        unsigned int y = 0;
+        unsigned int covered = 0;
+        for (std::size_t j = i; covered < width; ++j) {
+            y = std::max(y, mSkyline[j].y);
+            covered += mSkyline[j].width;
+        }
+        if (y + height > atlasHeight) continue;
+        if (!found || y < bestY) {
+            found = true;
+            bestNode = i;
+            bestY = y;
+        }
+    }
+    return found;
+}
+
+void TextureAtlas::insertNode(std::size_t node, unsigned int x, unsigned int y, unsigned int width) {
+    mSkyline.insert(mSkyline.begin() + static_cast<std::ptrdiff_t>(node), SkylineNode{x, y, width});
+
+    // Rognage des segments recouverts par le nouveau
+    for (std::size_t i = node + 1; i < mSkyline.size();) {
+        SkylineNode& next = mSkyline[i];
+        unsigned int end = x + width;
+        if (next.x >= end) break;
+        unsigned int shrink = std::min(end - next.x, next.width);
+        next.x += shrink;
+        next.width -= shrink;
+        if (next.width == 0) mSkyline.erase(mSkyline.begin() + static_cast<std::ptrdiff_t>(i));
+        else break;
+    }
+
+    // Fusion des segments voisins à la même hauteur
+    for (std::size_t i = 0; i + 1 < mSkyline.size();) {
+        if (mSkyline[i].y == mSkyline[i + 1].y) {
+            mSkyline[i].width += mSkyline[i + 1].width;
+            mSkyline.erase(mSkyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+}
+
+void TextureAtlas::blit(const Source& source, sf::Vector2u position) {
+    // Copie avec bordure répétée : le filtrage lit le bord de l'image, pas le voisin
+    unsigned int pad = Config::ATLAS_PADDING;
+    unsigned int width = source.size.x + 2 * pad;
+    unsigned int height = source.size.y + 2 * pad;
+    for (unsigned int y = 0; y < height; ++y) {
+        unsigned int sy = std::min(y > pad ? y - pad : 0u, source.size.y - 1);
+        std::uint8_t* row = &mPixels[(std::size_t(position.y + y) * mSize.x + position.x) * 4];
+        const std::uint8_t* src = &source.pixels[std::size_t(sy) * source.size.x * 4];
+        for (unsigned int x = 0; x < width; ++x) {
+            unsigned int sx = std::min(x > pad ? x - pad : 0u, source.size.x - 1);
+            std::memcpy(row + x * 4, src + sx * 4, 4);
+        }
+    }
+}
+
+bool TextureAtlas::upload(sf::Texture& texture) {
+    if (mPixels.empty() || !texture.resize(mSize)) return false;
+    texture.update(mPixels.data());
+    // Glyphes et voiture sont fortement réduits à l'affichage : filtrage + mipmaps, la bordure évite les voisins
+    texture.setSmooth(true);
+    if (!texture.generateMipmap()) std::cerr << "Atlas: mipmaps unavailable, bilinear filtering only" << std::endl;
+
+    // Les copies CPU ne servent plus : seules les régions restent
+    mPixels = std::vector<std::uint8_t>();
+    mSources = std::vector<Source>();
+    mSkyline = std::vector<SkylineNode>();
+    return true;
+}
+
+const sf::IntRect* TextureAtlas::find(const std::string& name) const {
+    auto it = mRegions.find(name);
+    return it != mRegions.end() ? &it->second : nullptr;
+}
+
+sf::Vector2u TextureAtlas::getSize() const {
+    return mSize;
+}
@@ -0,0 +1,112 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned int threadCount) : mStopping(false) {
+    if (threadCount == 0) {
+        unsigned int hardware = std::thread::hardware_concurrency();
+        threadCount = std::max(1u, hardware > 1 ? hardware - 1 : 1u);
+    }
+
+    mWorkers.reserve(threadCount);
+    for (unsigned int i = 0; i < threadCount; ++i) {
+        mWorkers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_all();
+    for (auto& worker : mWorkers) worker.join();
+}
+
+unsigned int ThreadPool::getThreadCount() const {
+    return static_cast<unsigned int>(mWorkers.size());
+}
+
+void ThreadPool::enqueue(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mJobs.push_back(std::move(job));
+    }
+    mCondition.notify_one();
+}
+
+bool ThreadPool::claimBatchChunk(std::size_t& begin, std::size_t& end) {
+    if (mBatchNext >= mBatchCount) return false;
+    begin = mBatchNext;
+    end = std::min(begin + mBatchChunkSize, mBatchCount);
+    mBatchNext = end;
+    return true;
+}
+
+void ThreadPool::runBatch(std::size_t count, BatchInvoke invoke, void* context) {
+    if (count == 0) return;
+    std::lock_guard<std::mutex> caller(mBatchCaller);
+    std::size_t chunks = std::min<std::size_t>(count, mWorkers.size() + 1);
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mBatchInvoke = invoke;
+        mBatchContext = context;
+        mBatchCount = count;
+        mBatchChunkSize = (count + chunks - 1) / chunks;
+        mBatchNext = 0;
+    }
+    mCondition.notify_all();
+
+    // Le thread appelant prend des morceaux comme les workers, puis attend ceux encore en cours
+    std::unique_lock<std::mutex> lock(mMutex);
+    std::size_t begin, end;
+    while (claimBatchChunk(begin, end)) {
+        lock.unlock();
+        invoke(context, begin, end);
+        lock.lock();
+    }
+    mBatchDone.wait(lock, [this]() { return mBatchRunning == 0; });
+    mBatchInvoke = nullptr;
+    mBatchContext = nullptr;
+    mBatchCount = 0;
+}
+
+bool ThreadPool::runPendingJob() {
+    std::function<void()> job;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mJobs.empty()) return false;
+        job = std::move(mJobs.front());
+        mJobs.pop_front();
+    }
+    job();
+    return true;
+}
+
+void ThreadPool::workerLoop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return mStopping || !mJobs.empty() || mBatchNext < mBatchCount; });
+
+            // Morceau d'un lot dispatch() en priorité : l'appelant l'attend
+            std::size_t begin, end;
+            if (claimBatchChunk(begin, end)) {
+                BatchInvoke invoke = mBatchInvoke;
+                void* context = mBatchContext;
+                mBatchRunning++;
+                lock.unlock();
+                invoke(context, begin, end);
+                lock.lock();
+                if (--mBatchRunning == 0) mBatchDone.notify_all();
+                continue;
+            }
+
+            // On vide la file avant de s'arrêter : aucun future ne reste orphelin
+            if (mJobs.empty()) return;
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+        job();
+    }
+}
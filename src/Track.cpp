@@ -1,28 +1,500 @@
 #include "Track.h"
+#include "AssetArchive.h"
+#include "Config.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
 
-Track::Track(sf::Texture& texture) : mSprite(texture) {
-    // Optimisation : Si la texture du circuit n'a pas de pixels semi-transparents,
-    // on désactive le lissage s'il n'est pas nécessaire (Pixel Art) ou on le laisse selon Config.
-    // mSprite.setTextureRect(...) peut être utilisé si besoin.
+namespace {
+    constexpr char LOD_MAGIC[8] = {'R', 'R', 'L', 'O', 'D', '0', '2', '\0'};
+
+    // En-tête du cache : magic, clé source, côté des tuiles, nombre de niveaux, puis (w, h) par niveau
+    constexpr std::size_t HEADER_FIXED_SIZE = sizeof(LOD_MAGIC) + sizeof(std::uint64_t) + 2 * sizeof(std::uint32_t);
+
+    std::size_t headerSizeOf(std::size_t levelCount) {
+        return HEADER_FIXED_SIZE + levelCount * 2 * sizeof(std::uint32_t);
+    }
+
+    constexpr std::size_t PNG_HEADER_SIZE = 24; // Signature + bloc IHDR jusqu'à la hauteur
+
+    // Taille lue dans l'en-tête IHDR d'un PNG, sans décoder l'image ; {0, 0} sinon
+    sf::Vector2u pngSizeOf(const std::uint8_t* header, std::size_t size) {
+        static const std::uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        if (size < PNG_HEADER_SIZE) return {};
+        if (std::memcmp(header, SIGNATURE, sizeof(SIGNATURE)) != 0 || std::memcmp(header + 12, "IHDR", 4) != 0) return {};
+        auto bigEndian = [&](int offset) {
+            return static_cast<unsigned int>(header[offset]) << 24 | static_cast<unsigned int>(header[offset + 1]) << 16
+                 | static_cast<unsigned int>(header[offset + 2]) << 8 | static_cast<unsigned int>(header[offset + 3]);
+        };
+        return {bigEndian(16), bigEndian(20)};
+    }
+
+    sf::Vector2u pngSizeOf(const std::string& path) {
+        std::uint8_t header[PNG_HEADER_SIZE];
+        std::ifstream file(path, std::ios::binary);
+        if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return {};
+        return pngSizeOf(header, sizeof(header));
+    }
+
+    // Niveaux réduits attendus pour une source : chaque niveau = moitié du précédent
+    std::uint32_t expectedLevelCount(sf::Vector2u size) {
+        std::uint32_t count = 0;
+        while (std::max(size.x, size.y) > Config::TRACK_LOD_MIN_SIZE) {
+            size = {std::max(1u, (size.x + 1) / 2), std::max(1u, (size.y + 1) / 2)};
+            count++;
+        }
+        return count;
+    }
+
+    // Le dernier niveau doit toujours avoir une texture entière (fond du menu)
+    static_assert(Config::TRACK_LOD_MIN_SIZE <= Config::TRACK_PREVIEW_MAX_SIZE, "smallest LOD level must get a preview texture");
+    // Le côté des tuiles est figé dans le cache : il doit tenir sur tout GPU (OpenGL garantit 1024)
+    static_assert(Config::TRACK_TILE_SIZE <= 1024, "tile size must fit the minimum GL texture size");
+}
+
+Track::Track(ThreadPool& pool)
+    : mPool(pool), mScale(1.f), mLodBias(0), mTileSize(Config::TRACK_TILE_SIZE), mStore(nullptr), mFrame(0) {}
+
+Track::~Track() {
+    // Les jobs en vol lisent le cache mappé : on attend leur fin avant destruction
+    for (auto& entry : mPending) entry.second.wait();
+}
+
+bool Track::loadFromFile(const std::string& path) {
+    if (!decodeFromFile(path)) return false;
+    createTextures();
+    return true;
+}
+
+bool Track::decodeFromFile(const std::string& path) {
+    // Cache valide : le PNG n'est pas décodé, seule sa taille est lue dans l'en-tête
+    std::uint64_t key = fileFingerprint(path);
+    if (openStore(path, key, pngSizeOf(path))) return true;
+
+    sf::Image image;
+    if (!image.loadFromFile(path)) return false;
+    buildStore(image.getPixelsPtr(), image.getSize(), path, key);
+    return true;
+}
+
+bool Track::decodeFromMemory(const std::uint8_t* data, std::size_t size, const std::string& name, std::uint64_t sourceKey) {
+    if (!data || size == 0) return false;
+    if (openStore(name, sourceKey, pngSizeOf(data, size))) return true;
+
+    sf::Image image;
+    if (!image.loadFromMemory(data, size)) return false;
+    buildStore(image.getPixelsPtr(), image.getSize(), name, sourceKey);
+    return true;
+}
+
+bool Track::decodeFromPixels(const std::uint8_t* pixels, sf::Vector2u size, const std::string& name, std::uint64_t sourceKey) {
+    if (!pixels || size.x == 0 || size.y == 0) return false;
+    if (!openStore(name, sourceKey, size)) buildStore(pixels, size, name, sourceKey);
+    return true;
+}
+
+std::string Track::cachePathOf(const std::string& name) const {
+    return Config::CACHE_PATH + std::filesystem::path(name).stem().string() + Config::TRACK_LOD_CACHE_EXTENSION;
+}
+
+void Track::setupLevels(sf::Vector2u sourceSize) {
+    mLevels.clear();
+    mTileOffset.clear();
+
+    // Pyramide jusqu'à TRACK_LOD_MIN_SIZE ; tuiles rangées niveau par niveau, lignes serrées
+    std::uint32_t levelCount = expectedLevelCount(sourceSize) + 1;
+    std::uint64_t offset = headerSizeOf(levelCount);
+    sf::Vector2u size = sourceSize;
+    int tileTotal = 0;
+    for (std::uint32_t i = 0; i < levelCount; ++i) {
+        Level level;
+        level.size = size;
+        level.tileCount = {(size.x + mTileSize - 1) / mTileSize, (size.y + mTileSize - 1) / mTileSize};
+        level.firstTile = tileTotal;
+        tileTotal += static_cast<int>(level.tileCount.x * level.tileCount.y);
+        mLevels.push_back(std::move(level));
+        size = {std::max(1u, (size.x + 1) / 2), std::max(1u, (size.y + 1) / 2)};
+    }
+
+    mTileOffset.resize(static_cast<std::size_t>(tileTotal) + 1);
+    for (int tile = 0; tile < tileTotal; ++tile) {
+        mTileOffset[static_cast<std::size_t>(tile)] = offset;
+        sf::Vector2u tileSize = tileSizeOf(tile);
+        offset += static_cast<std::uint64_t>(tileSize.x) * tileSize.y * 4;
+    }
+    mTileOffset.back() = offset; // Taille totale attendue du fichier
+}
+
+bool Track::openStore(const std::string& name, std::uint64_t sourceKey, sf::Vector2u sourceSize) {
+    // Les jobs en vol lisent l'ancien stockage : il doit leur survivre
+    for (auto& entry : mPending) entry.second.wait();
+    mPending.clear();
+
+    std::string cachePath = cachePathOf(name);
+    if (!mStoreFile.open(cachePath)) return false;
+
+    // Tout est vérifié avant usage : magic, clé, côté des tuiles, niveaux et taille du fichier
+    const std::uint8_t* data = mStoreFile.data();
+    std::size_t fileSize = mStoreFile.size();
+    std::uint64_t key = 0;
+    std::uint32_t tileSize = 0;
+    std::uint32_t levelCount = 0;
+    bool valid = fileSize >= HEADER_FIXED_SIZE && std::memcmp(data, LOD_MAGIC, sizeof(LOD_MAGIC)) == 0;
+    if (valid) {
+        std::memcpy(&key, data + 8, sizeof(key));
+        std::memcpy(&tileSize, data + 16, sizeof(tileSize));
+        std::memcpy(&levelCount, data + 20, sizeof(levelCount));
+        valid = key == sourceKey && tileSize == mTileSize && levelCount > 0 && fileSize >= headerSizeOf(levelCount);
+    }
+
+    std::vector<std::uint32_t> dims;
+    if (valid) {
+        dims.resize(static_cast<std::size_t>(levelCount) * 2);
+        std::memcpy(dims.data(), data + HEADER_FIXED_SIZE, dims.size() * sizeof(std::uint32_t));
+        // Source de taille inconnue (pas un PNG) : le niveau 0 du cache fait foi, la clé garantit la source
+        if (sourceSize.x == 0 || sourceSize.y == 0) sourceSize = {dims[0], dims[1]};
+        valid = sourceSize.x > 0 && sourceSize.y > 0 && levelCount == expectedLevelCount(sourceSize) + 1;
+    }
+
+    if (valid) {
+        setupLevels(sourceSize);
+        for (std::size_t i = 0; valid && i < mLevels.size(); ++i) {
+            valid = dims[i * 2] == mLevels[i].size.x && dims[i * 2 + 1] == mLevels[i].size.y;
+        }
+        valid = valid && fileSize == mTileOffset.back();
+    }
+
+    if (!valid) {
+        mStoreFile.close();
+        mLevels.clear();
+        return false;
+    }
+
+    mStoreMemory.clear();
+    mStoreMemory.shrink_to_fit();
+    mStore = mStoreFile.data();
+    std::cout << "Track LOD cache mapped: " << cachePath << std::endl;
+    return true;
+}
+
+void Track::buildStore(const std::uint8_t* pixels, sf::Vector2u size, const std::string& name, std::uint64_t sourceKey) {
+    for (auto& entry : mPending) entry.second.wait();
+    mPending.clear();
+    mStoreFile.close();
+    setupLevels(size);
+
+    std::vector<std::uint8_t> store(static_cast<std::size_t>(mTileOffset.back()));
+    std::uint32_t tileSize = mTileSize;
+    std::uint32_t levelCount = static_cast<std::uint32_t>(mLevels.size());
+    std::memcpy(store.data(), LOD_MAGIC, sizeof(LOD_MAGIC));
+    std::memcpy(store.data() + 8, &sourceKey, sizeof(sourceKey));
+    std::memcpy(store.data() + 16, &tileSize, sizeof(tileSize));
+    std::memcpy(store.data() + 20, &levelCount, sizeof(levelCount));
+    for (std::size_t i = 0; i < mLevels.size(); ++i) {
+        std::uint32_t dims[2] = {mLevels[i].size.x, mLevels[i].size.y};
+        std::memcpy(store.data() + HEADER_FIXED_SIZE + i * sizeof(dims), dims, sizeof(dims));
+    }
+
+    // Chaque niveau = moyenne 2x2 du précédent ; seuls deux niveaux pleins vivent en même temps
+    std::vector<std::uint8_t> current;
+    std::vector<std::uint8_t> next;
+    const std::uint8_t* in = pixels;
+    for (std::size_t levelIndex = 0; levelIndex < mLevels.size(); ++levelIndex) {
+        const Level& level = mLevels[levelIndex];
+        sf::Vector2u levelSize = level.size;
+
+        // Découpage du niveau en tuiles
+        std::size_t tileCount = static_cast<std::size_t>(level.tileCount.x) * level.tileCount.y;
+        mPool.parallelFor(tileCount, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t local = begin; local < end; ++local) {
+                int tile = level.firstTile + static_cast<int>(local);
+                sf::Vector2u tileSize = tileSizeOf(tile);
+                std::size_t ox = (local % level.tileCount.x) * mTileSize;
+                std::size_t oy = (local / level.tileCount.x) * mTileSize;
+                std::size_t rowBytes = static_cast<std::size_t>(tileSize.x) * 4;
+                std::uint8_t* out = store.data() + mTileOffset[static_cast<std::size_t>(tile)];
+                for (unsigned int row = 0; row < tileSize.y; ++row) {
+                    std::memcpy(out + row * rowBytes, in + ((oy + row) * levelSize.x + ox) * 4, rowBytes);
+                }
+            }
+        });
+
+        if (levelIndex + 1 == mLevels.size()) break;
+        sf::Vector2u dstSize = mLevels[levelIndex + 1].size;
+        next.resize(static_cast<std::size_t>(dstSize.x) * dstSize.y * 4);
+        mPool.parallelFor(dstSize.y, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t y = begin; y < end; ++y) {
+                std::size_t y0 = y * 2;
+                std::size_t y1 = std::min<std::size_t>(y0 + 1, levelSize.y - 1);
+                for (std::size_t x = 0; x < dstSize.x; ++x) {
+                    std::size_t x0 = x * 2;
+                    std::size_t x1 = std::min<std::size_t>(x0 + 1, levelSize.x - 1);
+                    std::size_t o = (y * dstSize.x + x) * 4;
+                    for (int c = 0; c < 4; ++c) {
+                        unsigned int sum = in[(y0 * levelSize.x + x0) * 4 + c] + in[(y0 * levelSize.x + x1) * 4 + c]
+                                         + in[(y1 * levelSize.x + x0) * 4 + c] + in[(y1 * levelSize.x + x1) * 4 + c];
+                        next[o + c] = static_cast<std::uint8_t>((sum + 2) / 4);
+                    }
+                }
+            }
+        });
+        current.swap(next);
+        in = current.data();
+    }
+
+    // Écriture dans un fichier temporaire puis renommage : jamais de cache à moitié écrit
+    std::string cachePath = cachePathOf(name);
+    std::string tempPath = cachePath + ".tmp";
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), ec);
+    {
+        std::ofstream file(tempPath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(store.data()), static_cast<std::streamsize>(store.size()));
+        file.close();
+        if (file) std::filesystem::rename(tempPath, cachePath, ec);
+        if (!file || ec) std::filesystem::remove(tempPath, ec);
+    }
+
+    // Le stockage en mémoire n'est gardé que si le cache n'a pas pu être écrit puis mappé
+    if (mStoreFile.open(cachePath) && mStoreFile.size() == store.size()) {
+        mStoreMemory.clear();
+        mStoreMemory.shrink_to_fit();
+        mStore = mStoreFile.data();
+    } else {
+        mStoreFile.close();
+        mStoreMemory = std::move(store);
+        mStore = mStoreMemory.data();
+    }
+}
+
+void Track::createTextures() {
+    // Les petits niveaux ont aussi une texture entière (menu, vues dézoomées), montée tuile par tuile
+    for (Level& level : mLevels) {
+        level.whole.reset();
+        if (std::max(level.size.x, level.size.y) > Config::TRACK_PREVIEW_MAX_SIZE) continue;
+        level.whole = std::make_unique<sf::Texture>();
+        if (!level.whole->resize(level.size)) continue;
+        int tileCount = static_cast<int>(level.tileCount.x * level.tileCount.y);
+        for (int local = 0; local < tileCount; ++local) {
+            int tile = level.firstTile + local;
+            sf::Vector2u origin((static_cast<unsigned int>(local) % level.tileCount.x) * mTileSize,
+                                (static_cast<unsigned int>(local) / level.tileCount.x) * mTileSize);
+            level.whole->update(mStore + mTileOffset[static_cast<std::size_t>(tile)], tileSizeOf(tile), origin);
+        }
+        level.whole->setSmooth(true);
+    }
+
+    mTileSlot.assign(mTileOffset.empty() ? 0 : mTileOffset.size() - 1, -1);
+    mCache.clear();
+    mCache.resize(Config::TRACK_TILE_CACHE_SIZE);
+
+    sf::Vector2u size = getImageSize();
+    std::cout << "Track: " << size.x << "x" << size.y << " px, " << mLevels.size() << " LOD levels, "
+              << mTileSlot.size() << " tiles of " << mTileSize << " px" << std::endl;
+}
+
+int Track::levelOfTile(int tile) const {
+    int level = static_cast<int>(mLevels.size()) - 1;
+    while (level > 0 && mLevels[static_cast<std::size_t>(level)].firstTile > tile) level--;
+    return level;
+}
+
+sf::Vector2u Track::tileSizeOf(int tile) const {
+    const Level& level = mLevels[static_cast<std::size_t>(levelOfTile(tile))];
+    unsigned int local = static_cast<unsigned int>(tile - level.firstTile);
+    unsigned int ox = (local % level.tileCount.x) * mTileSize;
+    unsigned int oy = (local / level.tileCount.x) * mTileSize;
+    return {std::min(mTileSize, level.size.x - ox), std::min(mTileSize, level.size.y - oy)};
+}
+
+int Track::selectLevel(const sf::RenderTarget& target, const sf::FloatRect& viewRect) const {
+    // Texels de niveau 0 par pixel écran : au-delà de 2, on descend d'un niveau
+    float screenPixels = static_cast<float>(target.getViewport(target.getView()).size.x);
+    if (screenPixels <= 0.f || mScale <= 0.f) return 0;
+
+    float texelsPerPixel = (viewRect.size.x / mScale) / screenPixels;
+    int level = texelsPerPixel > 1.f ? static_cast<int>(std::floor(std::log2(texelsPerPixel))) : 0;
+    level += mLodBias;
+    return std::clamp(level, 0, static_cast<int>(mLevels.size()) - 1);
+}
+
+Track::TilePixels Track::extractTile(int tile) const {
+    // Lecture de la tuile dans le cache mappé : les défauts de page tombent sur le worker
+    TilePixels result;
+    result.tile = tile;
+    result.size = tileSizeOf(tile);
+    const std::uint8_t* begin = mStore + mTileOffset[static_cast<std::size_t>(tile)];
+    const std::uint8_t* end = mStore + mTileOffset[static_cast<std::size_t>(tile) + 1];
+    result.pixels.assign(begin, end);
+    return result;
+}
+
+void Track::requestTile(int tile) {
+    if (mTileSlot[static_cast<std::size_t>(tile)] >= 0 || mPending.count(tile)) return;
+    mPending.emplace(tile, mPool.submit([this, tile]() { return extractTile(tile); }));
+}
+
+int Track::makeResident(int tile) {
+    int slot = mTileSlot[static_cast<std::size_t>(tile)];
+    if (slot >= 0) return slot;
+
+    // Tuile visible absente : on ne peut pas attendre la frame suivante
+    auto it = mPending.find(tile);
+    if (it != mPending.end()) {
+        TilePixels pixels = it->second.get();
+        mPending.erase(it);
+        upload(std::move(pixels));
+    } else {
+        upload(extractTile(tile));
+    }
+    return mTileSlot[static_cast<std::size_t>(tile)];
 }
 
-void Track::render(sf::RenderWindow& window) {
-    // Le circuit est le fond du jeu. Il est généralement opaque.
-    // Désactiver le blending (calcul de transparence) économise beaucoup de GPU.
+void Track::upload(TilePixels&& pixels) {
+    // Victime LRU : emplacement libre ou le moins récemment dessiné (jamais celui de la frame courante)
+    int victim = -1;
+    std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t i = 0; i < mCache.size(); ++i) {
+        const CachedTile& cached = mCache[i];
+        if (cached.tile < 0) { victim = static_cast<int>(i); break; }
+        if (cached.lastUsed < mFrame && cached.lastUsed < oldest) {
+            oldest = cached.lastUsed;
+            victim = static_cast<int>(i);
+        }
+    }
+    if (victim < 0) return; // Préchargement seulement : render() dimensionne le cache pour toutes les tuiles visibles
+
+    CachedTile& slot = mCache[static_cast<std::size_t>(victim)];
+    if (slot.tile >= 0) mTileSlot[static_cast<std::size_t>(slot.tile)] = -1;
+    slot.tile = -1;
+
+    if (slot.texture.getSize().x < mTileSize) {
+        if (!slot.texture.resize({mTileSize, mTileSize})) return;
+    }
+    slot.texture.update(pixels.pixels.data(), pixels.size, {0, 0});
+    // Niveau 0 en pixels nets, niveaux réduits filtrés (moins d'aliasing)
+    slot.texture.setSmooth(levelOfTile(pixels.tile) > 0);
+    slot.tile = pixels.tile;
+    slot.size = pixels.size;
+    slot.lastUsed = mFrame;
+    mTileSlot[static_cast<std::size_t>(pixels.tile)] = victim;
+}
+
+void Track::collectReadyTiles() {
+    unsigned int uploads = 0;
+    for (auto it = mPending.begin(); it != mPending.end() && uploads < Config::TRACK_TILE_UPLOADS_PER_FRAME;) {
+        if (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            upload(it->second.get());
+            it = mPending.erase(it);
+            uploads++;
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Track::render(sf::RenderTarget& target, const sf::FloatRect& viewRect) {
+    if (mTileSlot.empty()) return;
+    mFrame++;
+
+    int levelIndex = selectLevel(target, viewRect);
+    const Level& level = mLevels[static_cast<std::size_t>(levelIndex)];
+    float levelScale = mScale * static_cast<float>(1 << levelIndex); // Monde par texel du niveau
+
+    // Vue en coordonnées de tuiles du niveau
+    float tileWorld = static_cast<float>(mTileSize) * levelScale;
+    auto toTile = [tileWorld](float v, unsigned int count) {
+        return std::clamp(static_cast<int>(std::floor(v / tileWorld)), 0, static_cast<int>(count) - 1);
+    };
+    int x0 = toTile(viewRect.position.x, level.tileCount.x);
+    int y0 = toTile(viewRect.position.y, level.tileCount.y);
+    int x1 = toTile(viewRect.position.x + viewRect.size.x, level.tileCount.x);
+    int y1 = toTile(viewRect.position.y + viewRect.size.y, level.tileCount.y);
+    int stride = static_cast<int>(level.tileCount.x);
+
+    // Le cache suit la vue : tuiles visibles + anneau de préchargement, jamais moins que TRACK_TILE_CACHE_SIZE
+    std::size_t needed = static_cast<std::size_t>(x1 - x0 + 3) * static_cast<std::size_t>(y1 - y0 + 3);
+    if (mCache.size() < needed) mCache.resize(needed);
+
+    // 1. Tuiles visibles : résidentes obligatoirement
+    for (int ty = y0; ty <= y1; ++ty) {
+        for (int tx = x0; tx <= x1; ++tx) {
+            int slot = makeResident(level.firstTile + ty * stride + tx);
+            if (slot >= 0) mCache[static_cast<std::size_t>(slot)].lastUsed = mFrame;
+        }
+    }
+
+    // 2. Anneau de préchargement autour de la vue (asynchrone)
+    for (int ty = std::max(y0 - 1, 0); ty <= std::min(y1 + 1, static_cast<int>(level.tileCount.y) - 1); ++ty) {
+        for (int tx = std::max(x0 - 1, 0); tx <= std::min(x1 + 1, stride - 1); ++tx) {
+            requestTile(level.firstTile + ty * stride + tx);
+        }
+    }
+    collectReadyTiles();
+
+    // 3. Dessin : un tableau de sommets par texture de tuile.
+    // Le circuit est opaque : pas de blending (gros gain GPU).
     sf::RenderStates states = sf::RenderStates::Default;
     states.blendMode = sf::BlendNone;
 
-    // Note : Si votre PNG a des zones transparentes où l'on doit voir la couleur de fond
-    // (le gris défini dans Engine.cpp), retirez la ligne ci-dessus.
-    // Mais pour un circuit plein, BlendNone est le meilleur boost de perf.
+    for (int ty = y0; ty <= y1; ++ty) {
+        for (int tx = x0; tx <= x1; ++tx) {
+            int slot = mTileSlot[static_cast<std::size_t>(level.firstTile + ty * stride + tx)];
+            if (slot < 0) continue;
+            const CachedTile& cached = mCache[static_cast<std::size_t>(slot)];
+
+            sf::Vector2f size(cached.size);
+            sf::Vector2f origin(static_cast<float>(tx) * static_cast<float>(mTileSize), static_cast<float>(ty) * static_cast<float>(mTileSize));
+            sf::Vector2f p0 = origin * levelScale;
+            sf::Vector2f p1 = (origin + size) * levelScale;
+
+            sf::Vertex quad[6] = {
+                {{p0.x, p0.y}, sf::Color::White, {0.f, 0.f}},
+                {{p1.x, p0.y}, sf::Color::White, {size.x, 0.f}},
+                {{p0.x, p1.y}, sf::Color::White, {0.f, size.y}},
+                {{p0.x, p1.y}, sf::Color::White, {0.f, size.y}},
+                {{p1.x, p0.y}, sf::Color::White, {size.x, 0.f}},
+                {{p1.x, p1.y}, sf::Color::White, {size.x, size.y}},
+            };
+            states.texture = &cached.texture;
+            target.draw(quad, 6, sf::PrimitiveType::Triangles, states);
+            Profiler::countDrawCall(6);
+        }
+    }
+}
 
-    window.draw(mSprite, states);
+const sf::Texture& Track::getPreviewTexture(sf::Vector2u targetSize) const {
+    // Plus petit niveau qui couvre encore la cible ; à défaut le plus grand disponible
+    const sf::Texture* best = nullptr;
+    for (auto it = mLevels.rbegin(); it != mLevels.rend(); ++it) {
+        if (!it->whole) continue;
+        best = it->whole.get();
+        sf::Vector2u size = it->size;
+        if (size.x >= targetSize.x && size.y >= targetSize.y) break;
+    }
+    if (!best) throw std::runtime_error("Track has no preview level");
+    return *best;
 }
 
 sf::FloatRect Track::getGlobalBounds() const {
-    return mSprite.getGlobalBounds();
+    sf::Vector2f size(getImageSize());
+    return sf::FloatRect({0.f, 0.f}, size * mScale);
 }
 
 void Track::setScale(float scale) {
-    mSprite.setScale({scale, scale});
-}
\ No newline at end of file
+    mScale = scale;
+}
+
+void Track::setLodBias(int bias) {
+    mLodBias = std::max(0, bias);
+}
+
+sf::Vector2u Track::getImageSize() const {
+    return mLevels.empty() ? sf::Vector2u() : mLevels[0].size;
+}
@@ -0,0 +1,476 @@
+#include "TrackCenterline.h"
+#include "Config.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+
+namespace {
+    constexpr char LINE_MAGIC[8] = {'R', 'R', 'L', 'I', 'N', 'E', '3', '\0'};
+
+    // Voisins dans l'ordre de Zhang-Suen : P2 (nord) puis sens horaire jusqu'à P9
+    constexpr int NX[8] = {0, 1, 1, 1, 0, -1, -1, -1};
+    constexpr int NY[8] = {-1, -1, 0, 1, 1, 1, 0, -1};
+
+    bool isDrivable(TerrainType type) {
+        return type != TerrainType::WALL && type != TerrainType::GRASS;
+    }
+
+    // Empreinte de la grille et des réglages : le cache suit le masque
+    std::uint64_t fingerprint(const std::vector<TerrainType>& grid, sf::Vector2u size) {
+        std::uint64_t hash = 1469598103934665603ull;
+        auto mix = [&](std::uint64_t value) { hash = (hash ^ value) * 1099511628211ull; };
+        mix(size.x);
+        mix(size.y);
+        mix(Config::CENTERLINE_GRID_MAX);
+        mix(Config::CENTERLINE_CONTROL_SPACING);
+        mix(Config::CENTERLINE_SMOOTHING);
+
+        // 8 cellules à la fois
+        std::size_t words = grid.size() / 8;
+        const auto* bytes = reinterpret_cast<const std::uint8_t*>(grid.data());
+        for (std::size_t i = 0; i < words; ++i) {
+            std::uint64_t word;
+            std::memcpy(&word, bytes + i * 8, sizeof(word));
+            mix(word);
+        }
+        for (std::size_t i = words * 8; i < grid.size(); ++i) mix(bytes[i]);
+        return hash;
+    }
+
+    sf::Vector2f normalized(sf::Vector2f v) {
+        float length = std::sqrt(v.x * v.x + v.y * v.y);
+        return length > 0.f ? v / length : sf::Vector2f(1.f, 0.f);
+    }
+
+    // Catmull-Rom uniforme sur le segment p1 -> p2
+    sf::Vector2f catmullRom(sf::Vector2f p0, sf::Vector2f p1, sf::Vector2f p2, sf::Vector2f p3, float t) {
+        float t2 = t * t;
+        float t3 = t2 * t;
+        return 0.5f * (2.f * p1 + (p2 - p0) * t + (2.f * p0 - 5.f * p1 + 4.f * p2 - p3) * t2 +
+                       (3.f * p1 - p0 - 3.f * p2 + p3) * t3);
+    }
+
+    sf::Vector2f catmullRomDerivative(sf::Vector2f p0, sf::Vector2f p1, sf::Vector2f p2, sf::Vector2f p3, float t) {
+        return 0.5f * ((p2 - p0) + 2.f * (2.f * p0 - 5.f * p1 + 4.f * p2 - p3) * t +
+                       3.f * (3.f * p1 - p0 - 3.f * p2 + p3) * t * t);
+    }
+}
+
+TrackCenterline::TrackCenterline()
+    : mCornerMargin(0.f), mLapTime(0.f), mWorldScale(1.f), mKey(0), mLength(0.f), mSpacing(0.f) {}
+
+bool TrackCenterline::load(const CollisionMask& mask, float worldScale, sf::Vector2f startHeading,
+                           const std::string& cachePath, ThreadPool& pool) {
+    mKey = fingerprint(mask.getGrid(), mask.getSize());
+    if (loadCache(cachePath, mKey)) {
+        fitSpline(worldScale);
+        std::cout << "Centerline cache loaded: " << cachePath << (hasRacingLine() ? " (racing line)" : "") << std::endl;
+        return true;
+    }
+    if (!build(mask, worldScale, startHeading, pool)) return false;
+    if (!save(cachePath)) std::cerr << "Cannot write centerline cache " << cachePath << std::endl;
+    return true;
+}
+
+bool TrackCenterline::build(const CollisionMask& mask, float worldScale, sf::Vector2f startHeading, ThreadPool& pool) {
+    const std::vector<TerrainType>& terrain = mask.getGrid();
+    sf::Vector2u maskSize = mask.getSize();
+    if (terrain.empty()) return false;
+
+    // 1. Grille de travail réduite : l'amincissement coûte une passe par pixel de demi-largeur
+    unsigned int factor = std::max(1u, (std::max(maskSize.x, maskSize.y) + Config::CENTERLINE_GRID_MAX - 1) / Config::CENTERLINE_GRID_MAX);
+    int width = static_cast<int>(maskSize.x / factor);
+    int height = static_cast<int>(maskSize.y / factor);
+    if (width < 3 || height < 3) return false;
+
+    std::vector<std::uint8_t> grid(static_cast<std::size_t>(width) * height, 0);
+    pool.parallelFor(static_cast<std::size_t>(height), [&](std::size_t begin, std::size_t end) {
+        for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y) {
+            if (y == 0 || y == height - 1) continue; // Bord à 0 : pas de test de limites ensuite
+            for (int x = 1; x < width - 1; ++x) {
+                std::size_t mx = static_cast<std::size_t>(x) * factor + factor / 2;
+                std::size_t my = static_cast<std::size_t>(y) * factor + factor / 2;
+                grid[static_cast<std::size_t>(y) * width + x] = isDrivable(terrain[my * maskSize.x + mx]) ? 1 : 0;
+            }
+        }
+    });
+
+    // 2. Amincissement de Zhang-Suen : marquage en parallèle sur l'état précédent, puis effacement
+    auto at = [&](int x, int y) -> std::uint8_t& { return grid[static_cast<std::size_t>(y) * width + x]; };
+    std::vector<std::uint8_t> remove(grid.size(), 0);
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int step = 0; step < 2; ++step) {
+            std::atomic<bool> marked{false};
+            pool.parallelFor(static_cast<std::size_t>(height - 2), [&](std::size_t begin, std::size_t end) {
+                bool any = false;
+                for (int y = static_cast<int>(begin) + 1; y < static_cast<int>(end) + 1; ++y) {
+                    for (int x = 1; x < width - 1; ++x) {
+                        std::size_t i = static_cast<std::size_t>(y) * width + x;
+                        remove[i] = 0;
+                        if (!grid[i]) continue;
+
+                        std::uint8_t p[8];
+                        int neighbours = 0;
+                        for (int k = 0; k < 8; ++k) neighbours += p[k] = at(x + NX[k], y + NY[k]);
+                        if (neighbours < 2 || neighbours > 6) continue;
+
+                        int transitions = 0;
+                        for (int k = 0; k < 8; ++k) transitions += !p[k] && p[(k + 1) % 8];
+                        if (transitions != 1) continue;
+
+                        // p[0]=P2 (N), p[2]=P4 (E), p[4]=P6 (S), p[6]=P8 (O)
+                        bool erase = step == 0
+                            ? !(p[0] && p[2] && p[4]) && !(p[2] && p[4] && p[6])
+                            : !(p[0] && p[2] && p[6]) && !(p[0] && p[4] && p[6]);
+                        if (erase) { remove[i] = 1; any = true; }
+                    }
+                }
+                if (any) marked = true;
+            });
+            if (!marked) continue;
+            changed = true;
+            pool.parallelFor(grid.size(), [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) grid[i] &= static_cast<std::uint8_t>(!remove[i]);
+            });
+        }
+    }
+
+    // 3. Élagage des branches mortes : seules les boucles survivent
+    auto countNeighbours = [&](int x, int y) {
+        int count = 0;
+        for (int k = 0; k < 8; ++k) count += at(x + NX[k], y + NY[k]);
+        return count;
+    };
+    std::deque<std::size_t> endpoints;
+    for (int y = 1; y < height - 1; ++y) {
+        for (int x = 1; x < width - 1; ++x) {
+            if (at(x, y) && countNeighbours(x, y) <= 1) endpoints.push_back(static_cast<std::size_t>(y) * width + x);
+        }
+    }
+    while (!endpoints.empty()) {
+        std::size_t i = endpoints.front();
+        endpoints.pop_front();
+        int x = static_cast<int>(i % width);
+        int y = static_cast<int>(i / width);
+        if (!grid[i] || countNeighbours(x, y) > 1) continue;
+        grid[i] = 0;
+        for (int k = 0; k < 8; ++k) {
+            int nx = x + NX[k];
+            int ny = y + NY[k];
+            if (at(nx, ny)) endpoints.push_back(static_cast<std::size_t>(ny) * width + nx);
+        }
+    }
+
+    // 4. Départ : pixel du squelette le plus proche du centre de la ligne d'arrivée
+    double sumX = 0.0, sumY = 0.0;
+    std::size_t finishCells = 0;
+    for (std::size_t i = 0; i < terrain.size(); ++i) {
+        if (terrain[i] != TerrainType::FINISH_LINE) continue;
+        sumX += static_cast<double>(i % maskSize.x);
+        sumY += static_cast<double>(i / maskSize.x);
+        finishCells++;
+    }
+    sf::Vector2f finish = finishCells > 0
+        ? sf::Vector2f(static_cast<float>(sumX / finishCells), static_cast<float>(sumY / finishCells))
+        : sf::Vector2f(Config::CAR_INITIAL_POS_X, Config::CAR_INITIAL_POS_Y) / worldScale;
+    finish /= static_cast<float>(factor);
+
+    int startX = -1, startY = -1;
+    float bestDistance = std::numeric_limits<float>::max();
+    std::size_t skeletonSize = 0;
+    for (int y = 1; y < height - 1; ++y) {
+        for (int x = 1; x < width - 1; ++x) {
+            if (!at(x, y)) continue;
+            skeletonSize++;
+            float dx = x - finish.x;
+            float dy = y - finish.y;
+            if (dx * dx + dy * dy < bestDistance) {
+                bestDistance = dx * dx + dy * dy;
+                startX = x;
+                startY = y;
+            }
+        }
+    }
+    if (startX < 0) {
+        std::cerr << "Centerline: no closed loop in the drivable area" << std::endl;
+        return false;
+    }
+
+    // 5. Parcours dans le sens de la course : à chaque pas, le voisin le plus dans l'axe
+    std::vector<sf::Vector2i> path{{startX, startY}};
+    std::vector<std::uint8_t> visited(grid.size(), 0);
+    visited[static_cast<std::size_t>(startY) * width + startX] = 1;
+    sf::Vector2f direction = normalized(startHeading);
+    constexpr std::size_t MIN_LOOP = 16;
+    constexpr std::size_t DIRECTION_WINDOW = 6;
+
+    while (true) {
+        sf::Vector2i current = path.back();
+        if (path.size() > MIN_LOOP && std::abs(current.x - startX) <= 1 && std::abs(current.y - startY) <= 1) break;
+        if (path.size() > skeletonSize) return false;
+
+        int best = -1;
+        float bestAlignment = -0.3f; // Jamais de demi-tour
+        for (int k = 0; k < 8; ++k) {
+            int nx = current.x + NX[k];
+            int ny = current.y + NY[k];
+            std::size_t i = static_cast<std::size_t>(ny) * width + nx;
+            if (!grid[i] || visited[i]) continue;
+            float alignment = normalized(sf::Vector2f(static_cast<float>(NX[k]), static_cast<float>(NY[k]))).dot(direction);
+            if (alignment > bestAlignment) {
+                bestAlignment = alignment;
+                best = k;
+            }
+        }
+        if (best < 0) {
+            std::cerr << "Centerline: skeleton walk stopped after " << path.size() << " pixels" << std::endl;
+            return false;
+        }
+
+        sf::Vector2i next(current.x + NX[best], current.y + NY[best]);
+        visited[static_cast<std::size_t>(next.y) * width + next.x] = 1;
+        path.push_back(next);
+
+        // Direction lissée sur les derniers pixels (escaliers du squelette)
+        std::size_t back = std::min(path.size() - 1, DIRECTION_WINDOW);
+        direction = normalized(sf::Vector2f(path.back() - path[path.size() - 1 - back]));
+    }
+
+    // 6. Moyenne glissante sur la boucle fermée, puis points de contrôle répartis régulièrement
+    //    (pas de segment écourté à la fermeture de la boucle)
+    const int count = static_cast<int>(path.size());
+    const int radius = static_cast<int>(Config::CENTERLINE_SMOOTHING);
+    const int controlCount = std::max(4, count / static_cast<int>(Config::CENTERLINE_CONTROL_SPACING));
+    mControlPoints.clear();
+    mRacingKnots.clear(); // Ligne optimisée sur l'ancien squelette : caduque
+    for (int c = 0; c < controlCount; ++c) {
+        int i = c * count / controlCount;
+        sf::Vector2f sum;
+        for (int k = -radius; k <= radius; ++k) sum += sf::Vector2f(path[static_cast<std::size_t>((i + k + count) % count)]);
+        sf::Vector2f center = sum / static_cast<float>(2 * radius + 1);
+        mControlPoints.push_back((center + sf::Vector2f(0.5f, 0.5f)) * static_cast<float>(factor));
+    }
+    if (mControlPoints.size() < 4) return false;
+
+    fitSpline(worldScale);
+    std::cout << "Centerline built: " << mControlPoints.size() << " control points, length " << mLength << std::endl;
+    return true;
+}
+
+void TrackCenterline::fitSpline(float worldScale) {
+    mWorldScale = worldScale;
+    const std::size_t count = mControlPoints.size();
+    std::vector<sf::Vector2f> points(count);
+    for (std::size_t i = 0; i < count; ++i) points[i] = mControlPoints[i] * worldScale;
+    auto control = [&](std::size_t segment, int offset) {
+        return points[(segment + count + static_cast<std::size_t>(offset)) % count];
+    };
+
+    // Table d'abscisse curviligne : SUBSTEPS cordes par segment
+    constexpr std::size_t SUBSTEPS = 16;
+    std::vector<float> arc(count * SUBSTEPS + 1, 0.f);
+    sf::Vector2f previous = points[0];
+    for (std::size_t j = 1; j < arc.size(); ++j) {
+        std::size_t segment = (j / SUBSTEPS) % count;
+        float t = static_cast<float>(j % SUBSTEPS) / SUBSTEPS;
+        sf::Vector2f p = catmullRom(control(segment, -1), control(segment, 0), control(segment, 1), control(segment, 2), t);
+        arc[j] = arc[j - 1] + (p - previous).length();
+        previous = p;
+    }
+    mLength = arc.back();
+
+    // Rééchantillonnage à pas constant : les requêtes deviennent un index
+    std::size_t sampleCount = std::max<std::size_t>(4, static_cast<std::size_t>(mLength / Config::CENTERLINE_SAMPLE_SPACING));
+    mSpacing = mLength / static_cast<float>(sampleCount);
+    mSamples.resize(sampleCount);
+    mTangents.resize(sampleCount);
+    std::size_t j = 0;
+    for (std::size_t k = 0; k < sampleCount; ++k) {
+        float distance = k * mSpacing;
+        while (j + 1 < arc.size() - 1 && arc[j + 1] <= distance) ++j;
+        float chord = arc[j + 1] - arc[j];
+        float u = (static_cast<float>(j) + (chord > 0.f ? (distance - arc[j]) / chord : 0.f)) / SUBSTEPS;
+        std::size_t segment = std::min(static_cast<std::size_t>(u), count - 1);
+        float t = u - static_cast<float>(segment);
+        sf::Vector2f p0 = control(segment, -1), p1 = control(segment, 0), p2 = control(segment, 1), p3 = control(segment, 2);
+        mSamples[k] = catmullRom(p0, p1, p2, p3, t);
+        mTangents[k] = normalized(catmullRomDerivative(p0, p1, p2, p3, t));
+    }
+
+    // Courbure signée : variation d'angle de la tangente par unité de longueur,
+    // mesurée sur un intervalle de contrôle pour lisser le bruit du squelette
+    std::size_t baseline = std::max<std::size_t>(1, static_cast<std::size_t>(mLength / count / mSpacing));
+    mCurvatures.resize(sampleCount);
+    for (std::size_t k = 0; k < sampleCount; ++k) {
+        sf::Vector2f before = mTangents[(k + sampleCount - baseline % sampleCount) % sampleCount];
+        sf::Vector2f after = mTangents[(k + baseline) % sampleCount];
+        mCurvatures[k] = std::atan2(before.cross(after), before.dot(after)) / (2.f * baseline * mSpacing);
+    }
+}
+
+bool TrackCenterline::loadCache(const std::string& cachePath, std::uint64_t key) {
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file) return false;
+
+    char magic[8];
+    std::uint64_t cachedKey = 0;
+    std::uint32_t count = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&cachedKey), sizeof(cachedKey));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!file || std::memcmp(magic, LINE_MAGIC, sizeof(magic)) != 0 || cachedKey != key || count < 4) return false;
+
+    std::vector<sf::Vector2f> points(count);
+    file.read(reinterpret_cast<char*>(points.data()), static_cast<std::streamsize>(count * sizeof(sf::Vector2f)));
+
+    // Ligne de course optimisée (0 nœud si l'optimiseur n'est pas passé)
+    std::uint32_t knotCount = 0;
+    file.read(reinterpret_cast<char*>(&knotCount), sizeof(knotCount));
+    if (!file || knotCount > count * 64) return false;
+    std::vector<float> knots(knotCount);
+    file.read(reinterpret_cast<char*>(knots.data()), static_cast<std::streamsize>(knotCount * sizeof(float)));
+    file.read(reinterpret_cast<char*>(&mCornerMargin), sizeof(mCornerMargin));
+    file.read(reinterpret_cast<char*>(&mLapTime), sizeof(mLapTime));
+    if (!file) return false;
+
+    mControlPoints = std::move(points);
+    mRacingKnots = std::move(knots);
+    return true;
+}
+
+std::string TrackCenterline::cachePathOf(const std::string& maskFilename) {
+    return Config::CACHE_PATH + std::filesystem::path(maskFilename).stem().string() + Config::CENTERLINE_CACHE_EXTENSION;
+}
+
+bool TrackCenterline::save(const std::string& cachePath) const {
+    // Fichier temporaire puis renommage, comme le cache LOD : une ligne optimisée n'est jamais à moitié écrite
+    std::string tempPath = cachePath + ".tmp";
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), ec);
+    std::ofstream file(tempPath, std::ios::binary);
+
+    std::uint32_t count = static_cast<std::uint32_t>(mControlPoints.size());
+    std::uint32_t knotCount = static_cast<std::uint32_t>(mRacingKnots.size());
+    file.write(LINE_MAGIC, sizeof(LINE_MAGIC));
+    file.write(reinterpret_cast<const char*>(&mKey), sizeof(mKey));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(mControlPoints.data()), static_cast<std::streamsize>(count * sizeof(sf::Vector2f)));
+    file.write(reinterpret_cast<const char*>(&knotCount), sizeof(knotCount));
+    file.write(reinterpret_cast<const char*>(mRacingKnots.data()), static_cast<std::streamsize>(knotCount * sizeof(float)));
+    file.write(reinterpret_cast<const char*>(&mCornerMargin), sizeof(mCornerMargin));
+    file.write(reinterpret_cast<const char*>(&mLapTime), sizeof(mLapTime));
+    file.close();
+
+    if (file) std::filesystem::rename(tempPath, cachePath, ec);
+    if (file && !ec) return true;
+    std::filesystem::remove(tempPath, ec);
+    return false;
+}
+
+bool TrackCenterline::hasRacingLine() const {
+    return !mRacingKnots.empty();
+}
+
+TrackCenterline::RacingLine TrackCenterline::getRacingLine() const {
+    // Stockée en pixels du masque, comme les points de contrôle
+    RacingLine line;
+    line.knots.reserve(mRacingKnots.size());
+    for (float knot : mRacingKnots) line.knots.push_back(knot * mWorldScale);
+    line.cornerMargin = mCornerMargin;
+    line.lapTime = mLapTime;
+    return line;
+}
+
+void TrackCenterline::setRacingLine(const RacingLine& line) {
+    mRacingKnots.clear();
+    for (float knot : line.knots) mRacingKnots.push_back(knot / mWorldScale);
+    mCornerMargin = line.cornerMargin;
+    mLapTime = line.lapTime;
+}
+
+std::vector<float> TrackCenterline::expandKnots(const std::vector<float>& knots) const {
+    std::vector<float> offsets(mSamples.size(), 0.f);
+    const std::size_t count = knots.size();
+    if (count == 0) return offsets;
+
+    auto knot = [&](std::size_t k, int offset) { return knots[(k + count + static_cast<std::size_t>(offset)) % count]; };
+    float samplesPerKnot = static_cast<float>(mSamples.size()) / static_cast<float>(count);
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+        float u = static_cast<float>(i) / samplesPerKnot;
+        std::size_t k = std::min(static_cast<std::size_t>(u), count - 1);
+        float t = u - static_cast<float>(k);
+        float p0 = knot(k, -1), p1 = knot(k, 0), p2 = knot(k, 1), p3 = knot(k, 2);
+        offsets[i] = 0.5f * (2.f * p1 + (p2 - p0) * t + (2.f * p0 - 5.f * p1 + 4.f * p2 - p3) * t * t +
+                             (3.f * p1 - p0 - 3.f * p2 + p3) * t * t * t);
+    }
+    return offsets;
+}
+
+float TrackCenterline::wrap(float distance) const {
+    distance = std::fmod(distance, mLength);
+    return distance < 0.f ? distance + mLength : distance;
+}
+
+sf::Vector2f TrackCenterline::positionAt(float distance) const {
+    float u = wrap(distance) / mSpacing;
+    std::size_t i = static_cast<std::size_t>(u) % mSamples.size();
+    std::size_t next = (i + 1) % mSamples.size();
+    return mSamples[i] + (mSamples[next] - mSamples[i]) * (u - std::floor(u));
+}
+
+sf::Vector2f TrackCenterline::tangentAt(float distance) const {
+    float u = wrap(distance) / mSpacing;
+    std::size_t i = static_cast<std::size_t>(u) % mTangents.size();
+    std::size_t next = (i + 1) % mTangents.size();
+    return normalized(mTangents[i] + (mTangents[next] - mTangents[i]) * (u - std::floor(u)));
+}
+
+float TrackCenterline::curvatureAt(float distance) const {
+    float u = wrap(distance) / mSpacing;
+    std::size_t i = static_cast<std::size_t>(u) % mCurvatures.size();
+    std::size_t next = (i + 1) % mCurvatures.size();
+    return mCurvatures[i] + (mCurvatures[next] - mCurvatures[i]) * (u - std::floor(u));
+}
+
+float TrackCenterline::project(sf::Vector2f position, float hint) const {
+    if (mSamples.empty()) return 0.f;
+    const std::size_t count = mSamples.size();
+
+    // Recherche locale autour de la dernière projection, sinon sur tout le tour
+    std::size_t first = 0, span = count;
+    if (hint >= 0.f) {
+        std::size_t center = static_cast<std::size_t>(wrap(hint) / mSpacing);
+        span = std::min<std::size_t>(count, 2 * Config::CENTERLINE_PROJECT_WINDOW + 1);
+        first = (center + count - span / 2) % count;
+    }
+
+    float bestDistance = std::numeric_limits<float>::max();
+    float best = 0.f;
+    for (std::size_t n = 0; n < span; ++n) {
+        std::size_t i = (first + n) % count;
+        sf::Vector2f a = mSamples[i];
+        sf::Vector2f segment = mSamples[(i + 1) % count] - a;
+        float t = std::clamp((position - a).dot(segment) / std::max(segment.lengthSquared(), 1e-6f), 0.f, 1.f);
+        float d = (a + segment * t - position).lengthSquared();
+        if (d < bestDistance) {
+            bestDistance = d;
+            best = (static_cast<float>(i) + t) * mSpacing;
+        }
+    }
+    return wrap(best);
+}
+
+bool TrackCenterline::isValid() const { return !mSamples.empty(); }
+float TrackCenterline::getLength() const { return mLength; }
+float TrackCenterline::getSampleSpacing() const { return mSpacing; }
+const std::vector<sf::Vector2f>& TrackCenterline::getSamples() const { return mSamples; }
+const std::vector<sf::Vector2f>& TrackCenterline::getTangents() const { return mTangents; }
+const std::vector<float>& TrackCenterline::getCurvatures() const { return mCurvatures; }
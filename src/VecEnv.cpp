@@ -0,0 +1,173 @@
+#include "VecEnv.h"
+#include "HeadlessTrack.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+namespace {
+    constexpr float DEG_TO_RAD = 3.14159265f / 180.f;
+}
+
+VecEnv::VecEnv(std::size_t count, const sf::IntRect& carRect, ThreadPool& pool)
+    : mCarRect(carRect), mPool(pool)
+{
+    mCars.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) mCars.emplace_back(mTexture, mCarRect);
+
+    mArc.resize(count);
+    mDistance.resize(count);
+    mBestDistance.resize(count);
+    mSteps.resize(count);
+    mStallSteps.resize(count);
+    mRandom.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) mRandom.emplace_back(Config::VECENV_SEED + static_cast<unsigned int>(i));
+
+    mObservations.resize(count * OBSERVATION_SIZE);
+    mRewards.resize(count);
+    mDones.resize(count);
+}
+
+void VecEnv::reset(const CollisionMask& mask, const TrackCenterline& centerline, const sf::FloatRect& bounds) {
+    mMask = &mask;
+    mCenterline = &centerline;
+    mBounds = bounds;
+    mPool.dispatch(mCars.size(), [this](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            resetEnv(i);
+            mRewards[i] = 0.f;
+            mDones[i] = 0;
+        }
+    });
+}
+
+void VecEnv::step(const CarControls* actions) {
+    if (!mMask || !mCenterline) return;
+    mPool.dispatch(mCars.size(), [this, actions](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) stepEnv(i, actions[i]);
+    });
+}
+
+void VecEnv::resetEnv(std::size_t index) {
+    // Départ tiré au hasard sur la ligne centrale, dans le sens de la course
+    std::uniform_real_distribution<float> along(0.f, mCenterline->getLength());
+    float arc = along(mRandom[index]);
+    sf::Vector2f tangent = mCenterline->tangentAt(arc);
+
+    Car& car = mCars[index];
+    car.setPosition(mCenterline->positionAt(arc));
+    car.setRotation(std::atan2(tangent.y, tangent.x) / DEG_TO_RAD);
+    car.resetVelocity();
+
+    mArc[index] = arc;
+    mDistance[index] = 0.f;
+    mBestDistance[index] = 0.f;
+    mSteps[index] = 0;
+    mStallSteps[index] = 0;
+    observe(index);
+}
+
+void VecEnv::stepEnv(std::size_t index, const CarControls& action) {
+    static const sf::Time dt = sf::seconds(Config::TIME_PER_FRAME);
+    const float length = mCenterline->getLength();
+
+    Car& car = mCars[index];
+    car.update(dt, action, mBounds, *mMask);
+
+    // Progression le long de la ligne centrale, ramenée dans [-L/2, L/2] au passage de la ligne
+    float arc = mCenterline->project(car.getPosition(), mArc[index]);
+    float delta = arc - mArc[index];
+    if (delta > length / 2.f) delta -= length;
+    if (delta < -length / 2.f) delta += length;
+    mArc[index] = arc;
+    mDistance[index] += delta;
+
+    mRewards[index] = Config::VECENV_PROGRESS_REWARD * delta
+                    - Config::VECENV_GRASS_PENALTY * car.getGrassIntensity() * Config::TIME_PER_FRAME;
+
+    if (mDistance[index] > mBestDistance[index]) {
+        mBestDistance[index] = mDistance[index];
+        mStallSteps[index] = 0;
+    } else {
+        mStallSteps[index]++;
+    }
+    mSteps[index]++;
+
+    // Fin d'épisode : tour bouclé, voiture bloquée ou temps écoulé
+    bool done = mDistance[index] >= length
+             || mStallSteps[index] > static_cast<std::uint32_t>(Config::VECENV_STALL_TIME * Config::PHYSICS_FPS)
+             || mSteps[index] >= static_cast<std::uint32_t>(Config::VECENV_MAX_EPISODE_TIME * Config::PHYSICS_FPS);
+    mDones[index] = done ? 1 : 0;
+    if (done) resetEnv(index);
+    else observe(index);
+}
+
+void VecEnv::observe(std::size_t index) {
+    const Car& car = mCars[index];
+    sf::Vector2f position = car.getPosition();
+    float heading = car.getRotation() * DEG_TO_RAD;
+    float headX = std::cos(heading);
+    float headY = std::sin(heading);
+    float* out = &mObservations[index * OBSERVATION_SIZE];
+
+    // 1. Distances au mur, normalisées par la portée
+    mMask->raycastFan(position, car.getRotation(), Config::VECENV_RAYS, Config::VECENV_RAY_FOV, Config::VECENV_RAY_RANGE, out);
+    for (std::size_t r = 0; r < Config::VECENV_RAYS; ++r) out[r] /= Config::VECENV_RAY_RANGE;
+
+    // 2. Vitesse dans l'axe (négative en marche arrière)
+    sf::Vector2f velocity = car.getVelocity();
+    out[Config::VECENV_RAYS] = (velocity.x * headX + velocity.y * headY) / Config::CAR_MAX_SPEED;
+
+    // 3. Cap relatif à la tangente de la piste
+    sf::Vector2f tangent = mCenterline->tangentAt(mArc[index]);
+    out[Config::VECENV_RAYS + 1] = tangent.x * headY - tangent.y * headX;
+    out[Config::VECENV_RAYS + 2] = tangent.x * headX + tangent.y * headY;
+
+    // 4. Avancement dans le tour, depuis la ligne d'arrivée
+    out[Config::VECENV_RAYS + 3] = mArc[index] / mCenterline->getLength();
+}
+
+std::size_t VecEnv::getCount() const { return mCars.size(); }
+const float* VecEnv::getObservations() const { return mObservations.data(); }
+const float* VecEnv::getRewards() const { return mRewards.data(); }
+const std::uint8_t* VecEnv::getDones() const { return mDones.data(); }
+const Car& VecEnv::getCar(std::size_t index) const { return mCars[index]; }
+
+int VecEnv::runBenchmark() {
+    using Clock = std::chrono::steady_clock;
+
+    ThreadPool threadPool;
+    HeadlessTrack track("VecEnv benchmark");
+    if (!track.load(threadPool) || !track.loadCenterline(threadPool)) return 1;
+    const std::string& maskFilename = track.getMaskFilename();
+
+    VecEnv env(Config::VECENV_BENCH_ENVS, sf::IntRect({0, 0}, sf::Vector2i(track.getCarSize())), threadPool);
+    env.reset(track.getMask(), track.getCenterline(), track.getBounds());
+
+    // Actions aléatoires, retirées toutes les demi-secondes (accélérateur privilégié)
+    std::minstd_rand random(Config::VECENV_SEED);
+    std::vector<CarControls> actions(env.getCount());
+    std::size_t episodes = 0;
+    auto start = Clock::now();
+    for (std::size_t step = 0; step < Config::VECENV_BENCH_STEPS; ++step) {
+        if (step % static_cast<std::size_t>(Config::PHYSICS_FPS / 2.f) == 0) {
+            for (CarControls& action : actions) {
+                unsigned int bits = static_cast<unsigned int>(random());
+                action.accelerate = (bits & 3) != 0;
+                action.brake = (bits & 12) == 0;
+                action.turnLeft = (bits & 16) != 0;
+                action.turnRight = !action.turnLeft && (bits & 32) != 0;
+            }
+        }
+        env.step(actions.data());
+        for (std::size_t i = 0; i < env.getCount(); ++i) episodes += env.getDones()[i];
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    double steps = static_cast<double>(Config::VECENV_BENCH_STEPS * env.getCount());
+    std::printf("VecEnv benchmark: %zu envs x %zu steps on %s, %u threads\n", env.getCount(),
+                Config::VECENV_BENCH_STEPS, maskFilename.c_str(), threadPool.getThreadCount() + 1);
+    std::printf("  %.0f env steps/s (%.3f us per env step), %zu episodes ended\n",
+                steps / seconds, seconds * 1e6 / steps, episodes);
+    return 0;
+}
@@ -3,36 +3,137 @@
 #include <stdexcept>
 #include <algorithm>
 #include <cmath>
-
-World::World(sf::RenderWindow& window, AssetsManager& assetsManager)
-        : mWindow(window), mAssetsManager(assetsManager),
-          mTrack(assetsManager.getTexture("circuit")),
-          mPlayer(assetsManager.getTexture("voiture")),
-          mGhost(assetsManager),
+#include <filesystem>
+#include <iostream>
+
+World::World(sf::RenderWindow& window, AssetsManager& assetsManager, TextureHandle spriteAtlas, ThreadPool& threadPool,
+             std::unique_ptr<Track> track, CollisionMask&& collisionMask)
+        : mWindow(window), mAssetsManager(assetsManager), mThreadPool(threadPool),
+          mTrack(std::move(track)),
+          mPlayer(assetsManager.getTexture(spriteAtlas), assetsManager.getAtlasRegion(Config::SPRITE_CAR)),
+          mCollisionMask(std::move(collisionMask)),
+          mGhost(assetsManager, spriteAtlas),
+          mDrivers(assetsManager.getTexture(spriteAtlas), assetsManager.getAtlasRegion(Config::SPRITE_CAR)),
+          mParticles(Config::PARTICLE_CAPACITY),
           mLapCount(0) {
-    // ... (Chargement Mask inchangé) ...
-    std::string maskFilename = mAssetsManager.isUsingSDAssets() ? Config::FILE_MASK_SD : Config::FILE_MASK_HD;
-    if (!mCollisionMask.loadFromFile(Config::TEXTURES_PATH + maskFilename)) {
+    // Même classement en HD et en SD : l'identifiant ne dépend pas de la résolution chargée
+    mTrackId = std::filesystem::path(Config::FILE_CIRCUIT_HD).stem().string();
+}
+
+void World::selectResolution(AssetsManager& assets) {
+    // Le circuit est découpé en tuiles (Track) : la HD ne dépend plus de la taille
+    // max de texture du GPU, seulement de la présence des fichiers.
+    bool hdAvailable = assets.hasAsset(Config::TEXTURES_PATH + Config::FILE_CIRCUIT_HD) &&
+                       assets.hasAsset(Config::TEXTURES_PATH + Config::FILE_MASK_HD);
+    assets.setUseSDAssets(!hdAvailable);
+}
+
+std::string World::getMaskFilename(const AssetsManager& assets) {
+    return assets.isUsingSDAssets() ? Config::FILE_MASK_SD : Config::FILE_MASK_HD;
+}
+
+void World::decodeTrack(Track& track, const AssetsManager& assets) {
+    // Circuit en tuiles : plus de limite liée à la taille max de texture du GPU
+    std::string circuitFilename = assets.isUsingSDAssets() ? Config::FILE_CIRCUIT_SD : Config::FILE_CIRCUIT_HD;
+    std::string circuitPath = Config::TEXTURES_PATH + circuitFilename;
+
+    // Archive : PNG lu dans le mapping (décodé seulement si le cache LOD manque), ou pixels déjà décodés
+    const PackedAsset* packed = assets.findPacked(circuitPath);
+    bool ok = false;
+    if (!packed) ok = track.decodeFromFile(circuitPath);
+    else if (packed->format == PackFormat::Format::Raw) ok = track.decodeFromMemory(packed->data, packed->size, circuitPath, assets.getArchiveKey());
+    else ok = track.decodeFromPixels(packed->data, {packed->width, packed->height}, circuitPath, assets.getArchiveKey());
+    if (!ok) {
+        throw std::runtime_error("Failed to load " + circuitFilename);
+    }
+}
+
+void World::decodeCollisionMask(CollisionMask& mask, const AssetsManager& assets, ThreadPool& threadPool) {
+    std::string maskFilename = getMaskFilename(assets);
+    std::string maskPath = Config::TEXTURES_PATH + maskFilename;
+
+    // Archive RGBA : la classification lit directement les pages mappées ; sinon décodage (archive ou fichier)
+    const PackedAsset* packed = assets.findPacked(maskPath);
+    sf::Image image;
+    bool ok = packed && packed->format == PackFormat::Format::Rgba8
+        ? mask.loadFromPixels(packed->data, {packed->width, packed->height}, &threadPool)
+        : assets.loadImage(maskPath, image) && mask.loadFromPixels(image.getPixelsPtr(), image.getSize(), &threadPool);
+    if (!ok) {
         throw std::runtime_error("Failed to load " + maskFilename);
     }
+}
 
-    const sf::Texture& circuitTexture = mAssetsManager.getTexture("circuit");
-    sf::Vector2u texSize = circuitTexture.getSize();
-    float scaleFactor = static_cast<float>(Config::WINDOW_WIDTH) / static_cast<float>(texSize.x);
+void World::loadCenterline() {
+    // Description vectorielle du circuit (IA, progression) : construite une fois, puis relue du cache
+    std::string maskFilename = getMaskFilename(mAssetsManager);
+    std::string cachePath = TrackCenterline::cachePathOf(maskFilename);
+    float heading = Config::CAR_INITIAL_ROTATION * 3.14159265f / 180.f;
+    if (!mCenterline.load(mCollisionMask, getWorldScale(), {std::cos(heading), std::sin(heading)}, cachePath, mThreadPool)) {
+        std::cerr << "No centerline for " << maskFilename << std::endl;
+    }
+}
 
-    mTrack.setScale(scaleFactor);
+float World::getWorldScale() const {
+    return static_cast<float>(Config::WINDOW_WIDTH) / static_cast<float>(mTrack->getImageSize().x);
+}
+
+void World::finishLoading() {
+    mTrack->createTextures();
+
+    sf::Vector2u texSize = mTrack->getImageSize();
+    float scaleFactor = getWorldScale();
+
+    mTrack->setScale(scaleFactor);
     mCollisionMask.setScale(scaleFactor);
     mTrackSize = sf::Vector2f(texSize.x * scaleFactor, texSize.y * scaleFactor);
 
     mCheckpoints.setCollisionMask(&mCollisionMask);
+    mSkidMarks = std::make_unique<SkidMarkLayer>(mTrackSize);
+    mMinimap = std::make_unique<Minimap>(mCollisionMask, mTrackSize, mThreadPool);
 }
 
-void World::update(sf::Time deltaTime, sf::View& camera) {
+void World::spawnDrivers(std::size_t count) {
+    if (count == 0 || !mCenterline.isValid()) return;
+    // Ligne optimisée (--optimize-line) si le cache en contient une, sinon ligne centrale
+    if (mCenterline.hasRacingLine()) {
+        TrackCenterline::RacingLine line = mCenterline.getRacingLine();
+        mDrivers.setRacingLine(mCenterline, mCenterline.expandKnots(line.knots), line.cornerMargin);
+    } else {
+        mDrivers.setRacingLine(mCenterline);
+    }
+    mDrivers.spawn(count, mCenterline.project(mPlayer.getCar().getPosition()));
+}
+
+void World::buildHeatmap(const std::vector<std::string>& inputs) {
+    // Grille alignée sur le masque, couvrant le circuit
+    mHeatmap = std::make_unique<DrivingHeatmap>(mCollisionMask.getSize(), mTrackSize);
+    mHeatmap->addFiles(inputs, mThreadPool);
+}
+
+void World::uploadHeatmap() {
+    if (mHeatmap) mHeatmap->createTexture();
+}
+
+void World::toggleHeatmap() {
+    mShowHeatmap = !mShowHeatmap && mHeatmap;
+}
+
+void World::update(sf::Time deltaTime, const CarControls& controls, sf::View& camera) {
     float dt = deltaTime.asSeconds();
 
-    mPlayer.update(deltaTime, getTrackBounds(), mCollisionMask);
+    mPlayer.update(deltaTime, controls, getTrackBounds(), mCollisionMask);
+    mDrivers.update(deltaTime, getTrackBounds(), mCollisionMask);
+    mDrivers.resolveContacts(mPlayer.getCar(), mCollisionMask);
     mCheckpoints.update(mPlayer.getCar().getPosition());
 
+    // Fumée de drift et gerbes d'herbe
+    mParticles.emitFromCar(mPlayerEmitter, mPlayer.getCar(), dt);
+    mParticles.update(dt);
+
+    // Traces de pneus tamponnées une fois par tick
+    mSkidMarks->stampFromCar(mPlayerTrail, mPlayer.getCar());
+    mSkidMarks->update(dt);
+
     // Le ghost ne se mettra à jour que si startRace() a été appelé
     mGhost.update(dt, mPlayer.getCar());
 
@@ -55,21 +156,50 @@ void World::update(sf::Time deltaTime, sf::View& camera) {
     camera.setCenter(newPos);
 }
 
-void World::render(bool isPlaying, float alpha) {
-    // ... (Culling et Track render inchangé) ...
-    const sf::View& currentView = mWindow.getView();
+void World::render(sf::RenderTarget& target, bool isPlaying, float alpha) {
+    // Le Track ne dessine que les tuiles qui intersectent la vue
+    const sf::View& currentView = target.getView();
     sf::Vector2f center = currentView.getCenter();
     sf::Vector2f size = currentView.getSize();
-    float buffer = 100.f;
-    sf::FloatRect viewBounds({center.x - size.x/2.f - buffer, center.y - size.y/2.f - buffer}, {size.x + buffer*2, size.y + buffer*2});
+    sf::FloatRect viewBounds(center - size / 2.f, size);
     sf::FloatRect trackRect({0.f, 0.f}, mTrackSize);
 
     if (viewBounds.findIntersection(trackRect)) {
-        mTrack.render(mWindow);
+        mTrack->render(target, viewBounds);
     }
 
-    mGhost.render(mWindow, isPlaying);
-    mPlayer.render(mWindow, alpha);
+    // Traces de pneus : un quad par tuile de traces visible
+    mSkidMarks->render(target, viewBounds);
+
+    // Carte de chaleur des trajectoires (F4)
+    if (mShowHeatmap) mHeatmap->render(target);
+
+    // Particules sous les voitures (non texturées : un draw call s'il en reste en vie)
+    mParticles.render(target);
+
+    // Fantôme puis voitures, même couche et même atlas : un seul draw call, le fantôme dessous
+    mGhost.render(mBatch, isPlaying && mShowGhost);
+    mDrivers.render(mBatch, alpha);
+    mPlayer.render(mBatch, alpha);
+    mBatch.flush(target);
+}
+
+void World::setQuality(const QualitySettings& settings) {
+    mParticles.setLimit(static_cast<std::size_t>(Config::PARTICLE_CAPACITY * settings.particleFraction));
+    mShowGhost = settings.showGhost;
+    mTrack->setLodBias(settings.trackLodBias);
+}
+
+void World::renderMinimap(sf::RenderTarget& target, bool isPlaying, float alpha) {
+    const Car& car = mPlayer.getCar();
+    MinimapMarkers markers;
+    markers.carPosition = car.getInterpolatedPosition(alpha);
+    markers.carRotation = car.getRotation();
+    markers.ghostVisible = isPlaying && mShowGhost && mGhost.isGhostActive();
+    markers.ghostPosition = mGhost.getGhostPosition();
+    markers.ghostRotation = mGhost.getGhostRotation();
+    markers.checkpointPassed = mCheckpoints.hasStarted();
+    mMinimap->render(target, markers);
 }
 
 // NOUVEAU
@@ -98,13 +228,22 @@ bool World::isLapComplete() {
 void World::reset() {
     mCheckpoints.reset();
     mPlayer.reset();
+    mDrivers.reset();
     mGhost.reset();
+    mParticles.clear();
+    mPlayerEmitter = ParticleEmitter();
+    mSkidMarks->clear();
+    mPlayerTrail = SkidTrail();
     mLapCount = 0;
 }
 
 // Getters inchangés
+const Track& World::getTrack() const { return *mTrack; }
+const TrackCenterline& World::getCenterline() const { return mCenterline; }
 Player& World::getPlayer() { return mPlayer; }
 Car& World::getCar() { return mPlayer.getCar(); }
 int World::getLapCount() const { return mLapCount; }
+const std::string& World::getTrackId() const { return mTrackId; }
 GhostManager& World::getGhost() { return mGhost; }
+TerrainType World::getCarTerrain() const { return mCollisionMask.getTerrain(mPlayer.getCar().getPosition()); }
 bool World::isOnStartLine() const { return mCollisionMask.isOnBlue(mPlayer.getCar().getPosition()); }
\ No newline at end of file
@@ -0,0 +1,126 @@
+// Construit assets.pak à partir du dossier assets/ (appelé par CMake au build)
+// Usage : AssetPacker <dossier assets> <fichier .pak>
+#include "AssetArchive.h"
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    struct Blob {
+        PackFormat::Entry entry{};
+        std::vector<std::uint8_t> bytes;
+    };
+
+    std::size_t alignUp(std::size_t value) {
+        return (value + PackFormat::BLOB_ALIGNMENT - 1) / PackFormat::BLOB_ALIGNMENT * PackFormat::BLOB_ALIGNMENT;
+    }
+
+    bool readBlob(const fs::path& file, const std::string& name, Blob& blob) {
+        std::string extension = file.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+
+        // Petites images : décodées une fois ici, stockées en RGBA brut.
+        // Les grandes (circuits) restent en PNG : leur RGBA pèserait des centaines de Mo.
+        sf::Image image;
+        if (extension == ".png" && !image.loadFromFile(file)) return false;
+        sf::Vector2u size = image.getSize();
+        std::uint64_t decodedBytes = std::uint64_t(size.x) * size.y * 4;
+        if (extension == ".png" && decodedBytes <= PackFormat::RGBA8_MAX_BYTES) {
+            blob.bytes.assign(image.getPixelsPtr(), image.getPixelsPtr() + decodedBytes);
+            blob.entry.width = size.x;
+            blob.entry.height = size.y;
+            blob.entry.format = PackFormat::Format::Rgba8;
+        } else {
+            std::ifstream input(file, std::ios::binary);
+            if (!input) return false;
+            blob.bytes.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+            blob.entry.format = PackFormat::Format::Raw;
+        }
+
+        std::strncpy(blob.entry.name, name.c_str(), PackFormat::NAME_SIZE - 1);
+        blob.entry.size = blob.bytes.size();
+        return true;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: AssetPacker <assets directory> <output.pak>" << std::endl;
+        return 1;
+    }
+    fs::path root = argv[1];
+    fs::path output = argv[2];
+
+    // Ordre trié : archive identique d'un build à l'autre
+    std::vector<fs::path> files;
+    for (const auto& item : fs::recursive_directory_iterator(root)) {
+        // Caches dérivés et archive elle-même : jamais empaquetés
+        std::string name = fs::relative(item.path(), root).generic_string();
+        if (name.rfind("cache/", 0) == 0 || item.path().extension() == ".pak") continue;
+        if (item.is_regular_file()) files.push_back(item.path());
+    }
+    std::sort(files.begin(), files.end());
+
+    std::vector<Blob> blobs;
+    for (const fs::path& file : files) {
+        std::string name = fs::relative(file, root).generic_string();
+        if (name.size() >= PackFormat::NAME_SIZE) {
+            std::cerr << "Asset name too long: " << name << std::endl;
+            return 1;
+        }
+        Blob blob;
+        if (!readBlob(file, name, blob)) {
+            std::cerr << "Failed to read " << file << std::endl;
+            return 1;
+        }
+        blobs.push_back(std::move(blob));
+    }
+
+    // Disposition : en-tête, index, puis blobs alignés
+    std::size_t offset = alignUp(sizeof(PackFormat::Header) + blobs.size() * sizeof(PackFormat::Entry));
+    for (Blob& blob : blobs) {
+        blob.entry.offset = offset;
+        offset = alignUp(offset + blob.bytes.size());
+    }
+
+    // Écriture dans un fichier temporaire puis renommage : pas d'archive tronquée
+    fs::path temporary = output;
+    temporary += ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary);
+        if (!out) {
+            std::cerr << "Cannot write " << temporary << std::endl;
+            return 1;
+        }
+
+        PackFormat::Header header{};
+        std::memcpy(header.magic, PackFormat::MAGIC, sizeof(header.magic));
+        header.entryCount = static_cast<std::uint32_t>(blobs.size());
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const Blob& blob : blobs) {
+            out.write(reinterpret_cast<const char*>(&blob.entry), sizeof(blob.entry));
+        }
+        for (const Blob& blob : blobs) {
+            std::vector<char> padding(static_cast<std::size_t>(blob.entry.offset) - static_cast<std::size_t>(out.tellp()), 0);
+            out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+            out.write(reinterpret_cast<const char*>(blob.bytes.data()), static_cast<std::streamsize>(blob.bytes.size()));
+        }
+        if (!out) {
+            std::cerr << "Failed to write " << temporary << std::endl;
+            return 1;
+        }
+    }
+    fs::rename(temporary, output);
+
+    std::cout << "Packed " << blobs.size() << " assets into " << output.string()
+              << " (" << fs::file_size(output) / (1024 * 1024) << " MB)" << std::endl;
+    return 0;
+}